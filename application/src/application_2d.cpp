@@ -4,7 +4,10 @@
 #include "glm/gtc/type_ptr.hpp"
 #include "hnpch.h"
 #include "Honey/core/settings.h"
+#include "Honey/core/task_system.h"
+#include "Honey/physics/physics_engine_3d.h"
 #include "Honey/renderer/texture_cache.h"
+#include "Honey/scene/scene.h"
 #include "../../engine/src/Honey/loaders/gltf_loader.h"
 
 namespace Honey {
@@ -153,6 +156,8 @@ namespace Honey {
             auto stats_3d = Renderer3D::get_stats();
             ImGui::Text("Draw Calls: %u", stats_3d.draw_calls);
             ImGui::Text("Mesh Submissions: %u", stats_3d.mesh_submissions);
+            ImGui::Text("Culled Instances: %u", stats_3d.culled_instances);
+            ImGui::Text("Culled Submissions: %u", stats_3d.culled_submissions);
             ImGui::Text("Unique Meshes: %u", stats_3d.unique_meshes);
 
             ImGui::Separator();
@@ -163,10 +168,44 @@ namespace Honey {
             ImGui::Separator();
             ImGui::Text("Pipeline Binds: %u", stats_3d.pipeline_binds);
             ImGui::Text("Push Constant Updates: %u", stats_3d.push_constant_updates);
+            ImGui::Text("Instances Patched: %u", stats_3d.instances_patched);
+            ImGui::Text("Materials Patched: %u", stats_3d.materials_patched);
+            ImGui::Text("Bytes Uploaded: %llu", static_cast<unsigned long long>(stats_3d.bytes_uploaded));
 
             if (ImGui::Button("Reset 3D Statistics")) {
                 Renderer3D::reset_stats();
             }
+
+            ImGui::Separator();
+            ImGui::Text("3D Physics:");
+            auto& physics_3d = PhysicsEngine3D::get();
+            auto job_stats = physics_3d.get_job_stats();
+            ImGui::Text("Bodies: %u (%u active)", physics_3d.get_body_count(), physics_3d.get_active_body_count());
+            ImGui::Text("Jobs per Step: %u (%u inline)", job_stats.jobs, job_stats.inline_jobs);
+            ImGui::Text("Job Wait: %.3f ms (%u waits)", job_stats.wait_ms, job_stats.waits);
+
+            ImGui::Separator();
+            const MainQueueStats main_stats = TaskSystem::get_main_stats();
+            ImGui::Text("Main Queue: %u high, %u normal, %u low pending",
+                        main_stats.depth[(size_t)MainPriority::high],
+                        main_stats.depth[(size_t)MainPriority::normal],
+                        main_stats.depth[(size_t)MainPriority::low]);
+            ImGui::Text("Main Pump: %.3f / %.1f ms (%u tasks)", main_stats.pump_ms, main_stats.budget_ms, main_stats.executed);
+
+            if (Scene* scene = Scene::get_active_scene()) {
+                ImGui::Separator();
+                const auto& stages = scene->get_update_stages();
+                ImGui::Text("Scene Update: %.3f ms (%.3f ms serial, %u waves)",
+                            stages.get_frame_ms(), stages.get_serial_ms(), stages.get_wave_count());
+                for (const auto& timing : stages.get_timings()) {
+                    if (!timing.ran) {
+                        ImGui::Text("  %s: skipped", timing.name);
+                        continue;
+                    }
+                    ImGui::Text("  %s: %.3f ms (avg %.3f) wave %u%s", timing.name, timing.last_ms, timing.avg_ms,
+                                timing.wave, timing.on_worker ? ", worker" : "");
+                }
+            }
         }
 
         // Renderer Settings Section
@@ -0,0 +1,52 @@
+#include "Honey/core/log.h"
+#include "Honey/core/task_system.h"
+#include "Honey/debug/benchmarks.h"
+#include "Honey/physics/physics_engine_3d.h"
+#include "Honey/scripting/csharp_script_engine.h"
+
+#include <string_view>
+#include <vector>
+
+// Usage:
+//   benchmarks                 every native benchmark
+//   benchmarks <name>...       only the named ones, e.g. `benchmarks physics_3d_start`
+//   benchmarks --scripts       also the script-side ones (HoneyEngine.Benchmarks), which need .NET
+int main(int argc, char** argv) {
+    Honey::Log::init();
+
+    bool scripts = false;
+    std::vector<std::string_view> names;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--scripts")
+            scripts = true;
+        else
+            names.push_back(arg);
+    }
+
+    Honey::TaskSystem::init();
+    Honey::PhysicsEngine3D::init();
+
+    int result = 0;
+    if (names.empty()) {
+        Honey::Benchmarks::run_all();
+    } else {
+        for (std::string_view name : names) {
+            if (!Honey::Benchmarks::run(name)) {
+                HN_CORE_ERROR("[Benchmark] unknown benchmark '{}'", name);
+                result = 1;
+            }
+        }
+    }
+
+    if (scripts) {
+        Honey::CSharpScriptEngine::init();
+        if (!Honey::CSharpScriptEngine::run_benchmarks())
+            result = 1;
+        Honey::CSharpScriptEngine::shutdown();
+    }
+
+    Honey::PhysicsEngine3D::shutdown();
+    Honey::TaskSystem::shutdown();
+    return result;
+}
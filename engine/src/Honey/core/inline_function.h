@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Honey {
+
+    template<typename Signature, size_t Capacity = 64>
+    class InlineFunction;
+
+    // Move-only std::function replacement that keeps callables of up to Capacity bytes in place,
+    // so wrapping a typical lambda allocates nothing. Larger (or throwing-move) callables still
+    // work but go to the heap.
+    template<typename R, typename... Args, size_t Capacity>
+    class InlineFunction<R(Args...), Capacity> {
+    public:
+        InlineFunction() = default;
+
+        template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, InlineFunction>>>
+        InlineFunction(F&& f) { emplace(std::forward<F>(f)); }
+
+        InlineFunction(InlineFunction&& other) noexcept { move_from(other); }
+        InlineFunction& operator=(InlineFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        ~InlineFunction() { reset(); }
+
+        template<typename F>
+        void emplace(F&& f) {
+            using Fn = std::decay_t<F>;
+            reset();
+            if constexpr (fits_inline<Fn>()) {
+                new (m_storage) Fn(std::forward<F>(f));
+                m_invoke = [](void* storage, Args&&... args) -> R {
+                    return (*static_cast<Fn*>(storage))(std::forward<Args>(args)...);
+                };
+                m_manage = [](void* dst, void* src) {
+                    Fn* from = static_cast<Fn*>(src);
+                    if (dst)
+                        new (dst) Fn(std::move(*from));
+                    from->~Fn();
+                };
+            } else {
+                *reinterpret_cast<Fn**>(m_storage) = new Fn(std::forward<F>(f));
+                m_invoke = [](void* storage, Args&&... args) -> R {
+                    return (**static_cast<Fn**>(storage))(std::forward<Args>(args)...);
+                };
+                m_manage = [](void* dst, void* src) {
+                    Fn** from = static_cast<Fn**>(src);
+                    if (dst)
+                        *static_cast<Fn**>(dst) = *from;
+                    else
+                        delete *from;
+                };
+            }
+        }
+
+        void reset() {
+            if (m_manage)
+                m_manage(nullptr, m_storage);
+            m_invoke = nullptr;
+            m_manage = nullptr;
+        }
+
+        explicit operator bool() const noexcept { return m_invoke != nullptr; }
+
+        // Const so that one instance can be called from several threads at once, as parallel_for
+        // does; the callable itself must tolerate that.
+        R operator()(Args... args) const {
+            return m_invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+        }
+
+        template<typename F>
+        static constexpr bool fits_inline() {
+            return sizeof(F) <= Capacity
+                && alignof(F) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<F>;
+        }
+
+    private:
+        using InvokeFn = R (*)(void*, Args&&...);
+        // Moves the callable from src into dst and destroys the source; with a null dst, only destroys.
+        using ManageFn = void (*)(void* dst, void* src);
+
+        void move_from(InlineFunction& other) noexcept {
+            if (other.m_manage)
+                other.m_manage(m_storage, other.m_storage);
+            m_invoke = other.m_invoke;
+            m_manage = other.m_manage;
+            other.m_invoke = nullptr;
+            other.m_manage = nullptr;
+        }
+
+        alignas(std::max_align_t) std::byte m_storage[Capacity];
+        InvokeFn m_invoke = nullptr;
+        ManageFn m_manage = nullptr;
+    };
+
+}
@@ -171,6 +171,8 @@ namespace Honey {
             }
             if (auto n = renderer_node["ParallelMeshSubmission"])
                 s.renderer.enable_parallel_mesh_submission = n.as<bool>(s.renderer.enable_parallel_mesh_submission);
+            if (auto n = renderer_node["CPUFrustumCulling"])
+                s.renderer.enable_cpu_frustum_culling = n.as<bool>(s.renderer.enable_cpu_frustum_culling);
 
             if (auto n = renderer_node["AnisotropicFilteringLevel"]) {
                 try {
@@ -220,6 +222,28 @@ namespace Honey {
                     HN_CORE_WARN("Bad Physics.Substeps in settings: {}", e.what());
                 }
             }
+
+            if (auto n = physics_node["TickRate"]) {
+                try {
+                    s.physics.tick_rate = n.as<float>(s.physics.tick_rate);
+                } catch (const YAML::BadConversion& e) {
+                    HN_CORE_WARN("Bad Physics.TickRate in settings: {}", e.what());
+                }
+            }
+
+            if (auto n = physics_node["MaxStepsPerFrame"]) {
+                try {
+                    s.physics.max_steps_per_frame = n.as<int>(s.physics.max_steps_per_frame);
+                } catch (const YAML::BadConversion& e) {
+                    HN_CORE_WARN("Bad Physics.MaxStepsPerFrame in settings: {}", e.what());
+                }
+            }
+
+            if (auto n = physics_node["Interpolate"])
+                s.physics.interpolate = n.as<bool>(s.physics.interpolate);
+
+            if (auto n = physics_node["AsyncStep3D"])
+                s.physics.async_step_3d = n.as<bool>(s.physics.async_step_3d);
         }
 
         // ---------------- Window -----------------
@@ -270,6 +294,7 @@ namespace Honey {
 
         out << YAML::Key << "GeometryPath"            << YAML::Value << geometry_path_to_string(s.renderer.geometry_path);
         out << YAML::Key << "ParallelMeshSubmission"  << YAML::Value << s.renderer.enable_parallel_mesh_submission;
+        out << YAML::Key << "CPUFrustumCulling"       << YAML::Value << s.renderer.enable_cpu_frustum_culling;
 
         out << YAML::Key << "RendererType"            << YAML::Value << renderer_type_to_string(s.renderer.renderer_type);
 
@@ -291,6 +316,10 @@ namespace Honey {
 
         out << YAML::Key << "Enabled"  << YAML::Value << s.physics.enabled;
         out << YAML::Key << "Substeps" << YAML::Value << s.physics.substeps;
+        out << YAML::Key << "TickRate" << YAML::Value << s.physics.tick_rate;
+        out << YAML::Key << "MaxStepsPerFrame" << YAML::Value << s.physics.max_steps_per_frame;
+        out << YAML::Key << "Interpolate" << YAML::Value << s.physics.interpolate;
+        out << YAML::Key << "AsyncStep3D" << YAML::Value << s.physics.async_step_3d;
 
         out << YAML::EndMap; // Physics
 
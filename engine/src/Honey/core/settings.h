@@ -45,6 +45,7 @@ namespace Honey {
 
         GeometryPath geometry_path = GeometryPath::Meshlet;
         bool enable_parallel_mesh_submission = false;
+        bool enable_cpu_frustum_culling = true;
 
         RendererType renderer_type = RendererType::forward;
 
@@ -59,6 +60,16 @@ namespace Honey {
         bool enabled = true;
         int substeps = 6;
         bool show_jolt_debug_draw = false;
+
+        // Physics steps at a fixed rate, independent of the frame rate. After a hitch at most
+        // max_steps_per_frame steps are run and the rest of the backlog is dropped, so a slow
+        // frame can't snowball into slower ones.
+        float tick_rate = 60.0f;
+        int max_steps_per_frame = 4;
+        // Render bodies between their last two simulated poses instead of snapping to the latest.
+        bool interpolate = true;
+        // Run the next 3D step on a worker while the rest of the frame (render, scripts) proceeds.
+        bool async_step_3d = true;
     };
 
     struct EngineSettings {
@@ -0,0 +1,162 @@
+#include "hnpch.h"
+#include "task_graph.h"
+
+namespace Honey {
+
+    TaskGraph::~TaskGraph() {
+        HN_CORE_ASSERT(!m_started || is_complete(), "TaskGraph destroyed while its nodes are still running");
+    }
+
+    TaskGraph::Node TaskGraph::add_node(TaskRangeFunction fn, uint32_t count, uint32_t min_batch) {
+        HN_CORE_ASSERT(!m_started, "TaskGraph: nodes must be added before the graph starts");
+
+        const Node node = (Node)m_nodes.size();
+        NodeTask& task = m_nodes.emplace_back();
+        task.graph = this;
+        task.fn = std::move(fn);
+        task.min_batch = min_batch ? min_batch : 1;
+        set_count(node, count);
+        return node;
+    }
+
+    void TaskGraph::precede(Node before, Node after) {
+        HN_CORE_ASSERT(!m_started, "TaskGraph: edges must be added before the graph starts");
+        HN_CORE_ASSERT(before < m_nodes.size() && after < m_nodes.size() && before != after,
+                       "TaskGraph: invalid edge {0} -> {1}", before, after);
+
+        m_nodes[before].successors.push_back(after);
+        m_nodes[after].predecessor_count++;
+        m_nodes[after].SetDependency(m_edges.emplace_back(), &m_nodes[before]);
+    }
+
+    void TaskGraph::set_count(Node node, uint32_t count) {
+        NodeTask& task = m_nodes[node];
+        // enkiTS needs at least one partition to complete a task, so an empty node still runs
+        // once and skips the work.
+        task.count = count;
+        task.m_SetSize = count ? count : 1;
+        task.m_MinRange = node_min_range(task, task.m_SetSize);
+        task.remaining.store(task.m_SetSize, std::memory_order_relaxed);
+    }
+
+    uint32_t TaskGraph::node_min_range(const NodeTask& node, uint32_t count) const {
+        if (!m_gated)
+            return node.min_batch;
+        return detail::capped_min_range(count, node.min_batch, m_start.granted_slots);
+    }
+
+    void TaskGraph::NodeTask::ExecuteRange(enki::TaskSetPartition range, uint32_t) {
+        const uint32_t end = std::min(range.end, count);
+        if (range.start < end)
+            fn(range.start, end);
+
+        const uint32_t units = range.end - range.start;
+        if (remaining.fetch_sub(units, std::memory_order_acq_rel) == units)
+            graph->m_pending.fetch_sub(1, std::memory_order_release);
+    }
+
+    void TaskGraph::SinkTask::OnDependenciesComplete(enki::TaskScheduler* scheduler, uint32_t thread) {
+        if (fn)
+            fn();
+
+        if (graph->m_gated)
+            TaskSystem::release_background_slots(graph->m_start.granted_slots);
+
+        // The base call marks the sink complete, after which a launched graph may be released.
+        Ref<TaskGraph> self = std::move(graph->m_self);
+        enki::ICompletable::OnDependenciesComplete(scheduler, thread);
+    }
+
+    void TaskGraph::launch(Ref<TaskGraph> graph) {
+        if (!TaskSystem::is_initialized()) {
+            graph->run_inline();
+            return;
+        }
+
+        TaskGraph& g = *graph;
+        g.m_self = std::move(graph);
+        g.start(g.m_lane == TaskLane::background);
+    }
+
+    void TaskGraph::run() {
+        if (!TaskSystem::is_initialized()) {
+            run_inline();
+            return;
+        }
+
+        start(false);
+        TaskSystem::raw().WaitforTask(&m_sink, detail::to_enki_priority(m_lane));
+    }
+
+    void TaskGraph::start(bool gated) {
+        HN_PROFILE_FUNCTION();
+        HN_CORE_ASSERT(!m_started, "TaskGraph: a graph can only run once");
+        m_started = true;
+        m_gated = gated;
+        m_pending.store((uint32_t)m_nodes.size(), std::memory_order_relaxed);
+        m_sink.graph = this;
+
+        m_start.graph = this;
+        const enki::TaskPriority priority = detail::to_enki_priority(m_lane);
+        m_start.m_Priority = priority;
+        m_sink.m_Priority = priority;
+        for (NodeTask& node : m_nodes)
+            node.m_Priority = priority;
+
+        // One root, since enkiTS initializes dependencies from the task that is added: it precedes
+        // every node without predecessors, and the sink follows every node without successors.
+        for (NodeTask& node : m_nodes) {
+            if (node.predecessor_count == 0)
+                node.SetDependency(m_edges.emplace_back(), &m_start);
+            if (node.successors.empty())
+                m_sink.SetDependency(m_edges.emplace_back(), &node);
+        }
+        if (m_nodes.empty())
+            m_sink.SetDependency(m_edges.emplace_back(), &m_start);
+
+        // A launched graph may complete and free itself before this returns.
+        if (gated) {
+            // Node sizes are often only known once the graph runs, so ask for every free worker.
+            m_start.wanted_slots = UINT32_MAX;
+            TaskSystem::submit_background(&m_start, nullptr);
+        } else {
+            TaskSystem::raw().AddTaskSetToPipe(&m_start);
+        }
+    }
+
+    void TaskGraph::StartTask::start_background() {
+        for (NodeTask& node : graph->m_nodes)
+            node.m_MinRange = graph->node_min_range(node, node.m_SetSize);
+        TaskSystem::raw().AddTaskSetToPipe(this);
+    }
+
+    void TaskGraph::run_inline() {
+        HN_PROFILE_FUNCTION();
+        HN_CORE_ASSERT(!m_started, "TaskGraph: a graph can only run once");
+        m_started = true;
+
+        std::vector<uint32_t> waiting(m_nodes.size());
+        std::vector<Node> ready;
+        for (Node i = 0; i < (Node)m_nodes.size(); ++i) {
+            waiting[i] = m_nodes[i].predecessor_count;
+            if (waiting[i] == 0)
+                ready.push_back(i);
+        }
+
+        while (!ready.empty()) {
+            NodeTask& node = m_nodes[ready.back()];
+            ready.pop_back();
+            if (node.count)
+                node.fn(0, node.count);
+            for (Node next : node.successors) {
+                if (--waiting[next] == 0)
+                    ready.push_back(next);
+            }
+        }
+
+        m_pending.store(0, std::memory_order_release);
+        if (m_sink.fn)
+            m_sink.fn();
+    }
+
+}
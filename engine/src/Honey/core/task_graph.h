@@ -0,0 +1,130 @@
+#pragma once
+
+#include <TaskScheduler.h>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "Honey/core/base.h"
+#include "Honey/core/task_system.h"
+
+namespace Honey {
+
+    // Tasks with declared predecessors, run on the TaskSystem workers. enkiTS starts a node only
+    // once all of its predecessors have finished, so a pipeline such as parse -> decode -> build
+    // becomes a graph instead of workers blocking in nested TaskSystem::wait calls.
+    //
+    // Build the graph, then either launch() it, after which it keeps itself alive until its
+    // continuation has run, or run() it, which blocks while the calling thread helps. A graph runs
+    // once. A node may resize a successor that has not started yet (set_count), for work whose size
+    // is only known once an earlier node has run.
+    //
+    // Without an initialized TaskSystem both launch() and run() execute the graph inline.
+    //
+    // A graph launched in the background lane takes whatever background workers are free under
+    // TaskSystem::set_background_worker_limit when it starts, and holds them until it completes.
+    // Each node is split into at most that many partitions. Nodes without an order between them
+    // may run side by side, each with that many partitions. run() ignores the limit, since the
+    // caller is waiting anyway.
+    class TaskGraph {
+    public:
+        using Node = uint32_t;
+
+        TaskGraph() = default;
+        ~TaskGraph();
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        // A node that runs fn() once.
+        template<typename Func>
+        Node add(Func&& fn);
+        // A node that runs fn over [0, count) in partitions of at least min_batch indices. Like
+        // TaskSystem::parallel_for, fn takes either a (start, end) range or a single index.
+        template<typename Func>
+        Node add_for(uint32_t count, Func&& fn, uint32_t min_batch = 1);
+
+        // `after` does not start before `before` has finished.
+        void precede(Node before, Node after);
+        // Resizes an add_for node. Only valid before the node starts, e.g. from a predecessor.
+        void set_count(Node node, uint32_t count);
+
+        // Lane every node is queued at. Set before the graph starts.
+        void set_lane(TaskLane lane) { m_lane = lane; }
+
+        // Runs once every node has finished, on the thread that finished last.
+        template<typename Func>
+        void on_complete(Func&& fn) { m_sink.fn = std::forward<Func>(fn); }
+
+        static void launch(Ref<TaskGraph> graph);
+        void run();
+
+        // Completion counter: nodes that have not finished yet.
+        uint32_t get_pending() const { return m_pending.load(std::memory_order_acquire); }
+        bool is_complete() const { return m_started && get_pending() == 0; }
+
+    private:
+        struct NodeTask final : enki::ITaskSet {
+            TaskGraph* graph = nullptr;
+            TaskRangeFunction fn;
+            uint32_t count = 0;
+            uint32_t min_batch = 1;
+            // Set size units still to run; the partition that takes it to zero completes the node.
+            std::atomic<uint32_t> remaining{ 0 };
+            std::vector<Node> successors;
+            uint32_t predecessor_count = 0;
+
+            void ExecuteRange(enki::TaskSetPartition range, uint32_t thread) override;
+        };
+
+        struct StartTask final : enki::ITaskSet, detail::BackgroundWork {
+            TaskGraph* graph = nullptr;
+
+            void ExecuteRange(enki::TaskSetPartition, uint32_t) override {}
+            void start_background() override;
+        };
+
+        struct SinkTask final : enki::ICompletable {
+            TaskGraph* graph = nullptr;
+            InlineFunction<void()> fn;
+
+        protected:
+            void OnDependenciesComplete(enki::TaskScheduler* scheduler, uint32_t thread) override;
+        };
+
+        Node add_node(TaskRangeFunction fn, uint32_t count, uint32_t min_batch);
+        void start(bool gated);
+        void run_inline();
+        // Partition size for a node of count indices, given the workers the graph holds.
+        uint32_t node_min_range(const NodeTask& node, uint32_t count) const;
+
+        // Deques so that nodes and edges keep their addresses as the graph grows. Edges are
+        // declared last and so are destroyed first, while the tasks they link still exist.
+        std::deque<NodeTask> m_nodes;
+        StartTask m_start;
+        SinkTask m_sink;
+        std::deque<enki::Dependency> m_edges;
+
+        std::atomic<uint32_t> m_pending{ 0 };
+        TaskLane m_lane = TaskLane::normal;
+        bool m_started = false;
+        // Holds background worker slots (m_start.granted_slots), handed back by the sink.
+        bool m_gated = false;
+        // Holds a launched graph until its continuation has run.
+        Ref<TaskGraph> m_self;
+    };
+
+
+    template<typename Func>
+    TaskGraph::Node TaskGraph::add(Func&& fn) {
+        return add_node([fn = std::forward<Func>(fn)](uint32_t, uint32_t) mutable { fn(); }, 1, 1);
+    }
+
+    template<typename Func>
+    TaskGraph::Node TaskGraph::add_for(uint32_t count, Func&& fn, uint32_t min_batch) {
+        return add_node([fn = std::forward<Func>(fn)](uint32_t start, uint32_t end) mutable {
+            detail::invoke_range(fn, start, end);
+        }, count, min_batch);
+    }
+
+}
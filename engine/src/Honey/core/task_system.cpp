@@ -1,21 +1,144 @@
 #include "hnpch.h"
 #include "task_system.h"
 
+#include "Honey/core/timer.h"
+
+#include <thread>
+
 namespace Honey {
 
     namespace {
-        struct FunctionTaskSet final : enki::ITaskSet {
-            std::function<void()> fn;
+        constexpr uint32_t k_pool_block_size = 64;
+
+        // Tasks submitted by one thread. Only the owning thread takes slots; other threads just
+        // finish tasks or drop handles, which flips state the owner polls. Blocks are never
+        // freed before shutdown, so task addresses stay valid for as long as handles can exist.
+        struct TaskPool {
+            std::vector<std::unique_ptr<detail::PooledTask[]>> blocks;
+            std::vector<detail::PooledTask*> slots;
+            size_t cursor = 0;
+        };
+
+        std::mutex s_pools_mutex;
+        std::vector<std::unique_ptr<TaskPool>> s_pools;
+
+        thread_local TaskPool* t_pool = nullptr;
+        thread_local uint32_t t_pool_generation = 0;
+
+        struct MainNode {
+            std::atomic<MainNode*> next{ nullptr };
+            MainTask fn;
+            // Set by the thread that queued the node, cleared by the main thread once it has run.
+            std::atomic<bool> queued{ false };
+        };
+
+        // Main-thread task nodes of one producing thread, recycled like TaskPool slots: only the
+        // owner takes nodes, and the main thread gives them back by clearing `queued`.
+        struct MainNodePool {
+            std::vector<std::unique_ptr<MainNode[]>> blocks;
+            std::vector<MainNode*> nodes;
+            size_t cursor = 0;
+        };
+
+        std::vector<std::unique_ptr<MainNodePool>> s_main_pools;
 
-            explicit FunctionTaskSet(std::function<void()> f)
-                : fn(std::move(f)) {}
+        thread_local MainNodePool* t_main_pool = nullptr;
+        thread_local uint32_t t_main_pool_generation = 0;
 
-            void ExecuteRange(enki::TaskSetPartition, uint32_t) override {
-                if (fn) {
-                    fn();
+        // Intrusive multi-producer, single-consumer queue (Vyukov). A producer links its node in
+        // with one exchange on the head; only the main thread pops, from the tail. A stub node
+        // keeps the list non-empty so the two ends never contend.
+        class MainQueue {
+        public:
+            MainQueue() : m_head(&m_stub), m_tail(&m_stub) {}
+
+            void push(MainNode* node) {
+                // Counted before it is linked, so a concurrent pop cannot take the depth below zero.
+                m_depth.fetch_add(1, std::memory_order_relaxed);
+                link(node);
+            }
+
+            // Null when empty, or while a producer is between its exchange and its link; that
+            // node turns up on a later call.
+            MainNode* pop() {
+                MainNode* tail = m_tail;
+                MainNode* next = tail->next.load(std::memory_order_acquire);
+                if (tail == &m_stub) {
+                    if (!next)
+                        return nullptr;
+                    m_tail = next;
+                    tail = next;
+                    next = next->next.load(std::memory_order_acquire);
+                }
+
+                if (!next) {
+                    if (tail != m_head.load(std::memory_order_acquire))
+                        return nullptr;
+                    // The last node can only be handed out with something behind it.
+                    link(&m_stub);
+                    next = tail->next.load(std::memory_order_acquire);
+                    if (!next)
+                        return nullptr;
                 }
+
+                m_tail = next;
+                m_depth.fetch_sub(1, std::memory_order_relaxed);
+                return tail;
             }
+
+            uint32_t depth() const { return m_depth.load(std::memory_order_relaxed); }
+
+        private:
+            void link(MainNode* node) {
+                node->next.store(nullptr, std::memory_order_relaxed);
+                MainNode* prev = m_head.exchange(node, std::memory_order_acq_rel);
+                prev->next.store(node, std::memory_order_release);
+            }
+
+            std::atomic<MainNode*> m_head;
+            MainNode* m_tail;
+            MainNode m_stub;
+            std::atomic<uint32_t> m_depth{ 0 };
         };
+
+        MainQueue s_main_queues[(size_t)MainPriority::count];
+        MainQueueStats s_main_stats;
+
+        void finish_main_node(MainNode* node) {
+            node->fn.reset();
+            node->queued.store(false, std::memory_order_release);
+        }
+
+        void drop_main_queues() {
+            for (MainQueue& queue : s_main_queues) {
+                while (MainNode* node = queue.pop())
+                    finish_main_node(node);
+            }
+        }
+    }
+
+    void detail::PooledTask::ExecuteRange(enki::TaskSetPartition range, uint32_t) {
+        fn(base + range.start, base + range.end);
+        // A single-partition task drops its captures now rather than when the slot is reused.
+        if (m_SetSize == 1)
+            fn.reset();
+
+        if (lane == TaskLane::background) {
+            const uint32_t units = range.end - range.start;
+            if (remaining.fetch_sub(units, std::memory_order_acq_rel) == units)
+                TaskSystem::release_background_slots(granted_slots);
+        }
+    }
+
+    void detail::PooledTask::start_background() {
+        m_MinRange = capped_min_range(m_SetSize, min_range, granted_slots);
+        TaskSystem::s_scheduler.AddTaskSetToPipe(this);
+    }
+
+    void TaskHandle::release() {
+        if (m_task && m_generation == TaskSystem::s_generation)
+            m_task->held.store(false, std::memory_order_release);
+        m_task = nullptr;
     }
 
     void TaskSystem::init() {
@@ -29,9 +152,10 @@ namespace Honey {
 
         s_scheduler.Initialize(cfg);
         s_initialized = true;
+        s_background_limit = std::max(1u, s_scheduler.GetNumTaskThreads() / 2);
 
-        HN_CORE_INFO("TaskSystem initialized with {} worker threads",
-                     s_scheduler.GetNumTaskThreads());
+        HN_CORE_INFO("TaskSystem initialized with {} worker threads ({} for background work)",
+                     s_scheduler.GetNumTaskThreads(), s_background_limit);
     }
 
     void TaskSystem::shutdown() {
@@ -41,11 +165,22 @@ namespace Honey {
         // Ensure all outstanding work is complete before shutting down.
         s_scheduler.WaitforAllAndShutdown();
         s_initialized = false;
-        
-        // Clear any queued main-thread work.
+
+        // Drop any queued main-thread work while its nodes still exist.
+        drop_main_queues();
+
+        // Nothing can be running now. Outstanding handles and thread-local pool pointers go
+        // stale with the generation.
+        ++s_generation;
+        {
+            std::lock_guard<std::mutex> lock(s_pools_mutex);
+            s_pools.clear();
+            s_main_pools.clear();
+        }
         {
-            std::lock_guard<std::mutex> lock(s_main_mutex);
-            s_main_queue.clear();
+            std::lock_guard<std::mutex> lock(s_background_mutex);
+            s_background_backlog.clear();
+            s_background_running = 0;
         }
 
         HN_CORE_INFO("TaskSystem shutdown complete");
@@ -56,24 +191,147 @@ namespace Honey {
         return s_scheduler;
     }
 
-    TaskHandle TaskSystem::run_async(std::function<void()> fn) {
-        if (!s_initialized || !fn) {
-            return {};
+    detail::PooledTask* TaskSystem::acquire_task() {
+        if (!t_pool || t_pool_generation != s_generation) {
+            auto pool = std::make_unique<TaskPool>();
+            t_pool = pool.get();
+            t_pool_generation = s_generation;
+            std::lock_guard<std::mutex> lock(s_pools_mutex);
+            s_pools.push_back(std::move(pool));
+        }
+
+        // Round-robin from where the last search stopped: the oldest slots are the likeliest to be done.
+        TaskPool& pool = *t_pool;
+        const size_t count = pool.slots.size();
+        for (size_t n = 0; n < count; ++n) {
+            detail::PooledTask* task = pool.slots[pool.cursor];
+            pool.cursor = (pool.cursor + 1) % count;
+            if (!task->held.load(std::memory_order_acquire) && !task->deferred.load(std::memory_order_acquire)
+                && task->GetIsComplete())
+                return task;
+        }
+
+        // Every slot is in flight or still held: grow by a block.
+        auto block = std::make_unique<detail::PooledTask[]>(k_pool_block_size);
+        for (uint32_t i = 0; i < k_pool_block_size; ++i)
+            pool.slots.push_back(&block[i]);
+        detail::PooledTask* task = &block[0];
+        pool.cursor = (count + 1) % pool.slots.size();
+        pool.blocks.push_back(std::move(block));
+        return task;
+    }
+
+    TaskHandle TaskSystem::submit(TaskRangeFunction fn, uint32_t begin, uint32_t count, uint32_t min_range,
+                                  TaskLane lane) {
+        detail::PooledTask* task = acquire_task();
+        task->fn = std::move(fn);
+        task->base = begin;
+        task->lane = lane;
+        task->min_range = min_range;
+        task->m_SetSize = count;
+        task->m_MinRange = min_range;
+        task->m_Priority = detail::to_enki_priority(lane);
+        task->held.store(true, std::memory_order_relaxed);
+        if (lane == TaskLane::background) {
+            task->wanted_slots = (count + min_range - 1) / min_range;
+            task->remaining.store(count, std::memory_order_relaxed);
+            submit_background(task, &task->deferred);
+        } else {
+            s_scheduler.AddTaskSetToPipe(task);
         }
 
-        auto* task = new FunctionTaskSet(std::move(fn));
-        // Single partition – just run fn() once on some worker
-        s_scheduler.AddTaskSetToPipe(task);
-        return TaskHandle{ task };
+        TaskHandle handle;
+        handle.m_task = task;
+        handle.m_generation = s_generation;
+        return handle;
     }
 
-    void TaskSystem::wait(TaskHandle handle) {
-        if (!s_initialized || !handle.internal)
+    void TaskSystem::wait(TaskHandle& handle) {
+        if (!handle)
             return;
 
-        s_scheduler.WaitforTask(handle.internal);
-        delete handle.internal;
-        handle.internal = nullptr;
+        if (s_initialized && handle.m_generation == s_generation) {
+            detail::PooledTask* task = handle.m_task;
+            if (task->deferred.load(std::memory_order_acquire)) {
+                // Still waiting for a background worker: run it here rather than wait behind the
+                // backlog, which could deadlock if every background worker is itself waiting.
+                if (take_deferred(task)) {
+                    task->fn(task->base, task->base + task->m_SetSize);
+                    task->fn.reset();
+                    task->deferred.store(false, std::memory_order_release);
+                    handle.release();
+                    return;
+                }
+                // Being piped right now.
+                while (task->deferred.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+            }
+            // While it waits, this thread only helps with work at the task's own lane or above, so a
+            // frame-critical wait never picks up a background decode.
+            s_scheduler.WaitforTask(task, detail::to_enki_priority(task->lane));
+        }
+        handle.release();
+    }
+
+    void TaskSystem::submit_background(detail::BackgroundWork* work, std::atomic<bool>* deferred) {
+        {
+            std::lock_guard<std::mutex> lock(s_background_mutex);
+            if (s_background_running >= s_background_limit) {
+                if (deferred)
+                    deferred->store(true, std::memory_order_release);
+                s_background_backlog.push_back({ work, deferred });
+                return;
+            }
+            work->granted_slots = std::min(work->wanted_slots, s_background_limit - s_background_running);
+            s_background_running += work->granted_slots;
+        }
+        work->start_background();
+    }
+
+    void TaskSystem::release_background_slots(uint32_t slots) {
+        {
+            std::lock_guard<std::mutex> lock(s_background_mutex);
+            s_background_running -= slots;
+        }
+        start_background_backlog();
+    }
+
+    void TaskSystem::start_background_backlog() {
+        // One at a time, so that the lock is not held while enkiTS pipes the work.
+        while (true) {
+            DeferredTask next{};
+            {
+                std::lock_guard<std::mutex> lock(s_background_mutex);
+                if (!s_initialized || s_background_backlog.empty() || s_background_running >= s_background_limit)
+                    return;
+                next = s_background_backlog.front();
+                s_background_backlog.pop_front();
+                next.work->granted_slots = std::min(next.work->wanted_slots, s_background_limit - s_background_running);
+                s_background_running += next.work->granted_slots;
+            }
+            next.work->start_background();
+            // Cleared only once piped, so that a waiter that sees it clear also sees the task running.
+            if (next.deferred)
+                next.deferred->store(false, std::memory_order_release);
+        }
+    }
+
+    bool TaskSystem::take_deferred(detail::PooledTask* task) {
+        std::lock_guard<std::mutex> lock(s_background_mutex);
+        auto it = std::find_if(s_background_backlog.begin(), s_background_backlog.end(),
+                               [task](const DeferredTask& entry) { return entry.work == task; });
+        if (it == s_background_backlog.end())
+            return false;
+        s_background_backlog.erase(it);
+        return true;
+    }
+
+    void TaskSystem::set_background_worker_limit(uint32_t limit) {
+        {
+            std::lock_guard<std::mutex> lock(s_background_mutex);
+            s_background_limit = std::max(limit, 1u);
+        }
+        start_background_backlog();
     }
 
     void TaskSystem::wait_for_all() {
@@ -83,27 +341,88 @@ namespace Honey {
         s_scheduler.WaitforAll();
     }
     
-    void TaskSystem::enqueue_main(std::function<void()> fn) {
+    void TaskSystem::enqueue_main(MainTask fn, MainPriority priority) {
         if (!s_initialized || !fn)
             return;
 
-        std::lock_guard<std::mutex> lock(s_main_mutex);
-        s_main_queue.emplace_back(std::move(fn));
+        if (!t_main_pool || t_main_pool_generation != s_generation) {
+            auto pool = std::make_unique<MainNodePool>();
+            t_main_pool = pool.get();
+            t_main_pool_generation = s_generation;
+            std::lock_guard<std::mutex> lock(s_pools_mutex);
+            s_main_pools.push_back(std::move(pool));
+        }
+
+        // Same round-robin search as acquire_task; the pool grows by a block when every node is
+        // still queued.
+        MainNodePool& pool = *t_main_pool;
+        MainNode* node = nullptr;
+        for (size_t n = 0; n < pool.nodes.size() && !node; ++n) {
+            MainNode* candidate = pool.nodes[pool.cursor];
+            pool.cursor = (pool.cursor + 1) % pool.nodes.size();
+            if (!candidate->queued.load(std::memory_order_acquire))
+                node = candidate;
+        }
+        if (!node) {
+            const size_t count = pool.nodes.size();
+            auto block = std::make_unique<MainNode[]>(k_pool_block_size);
+            for (uint32_t i = 0; i < k_pool_block_size; ++i)
+                pool.nodes.push_back(&block[i]);
+            node = &block[0];
+            pool.cursor = (count + 1) % pool.nodes.size();
+            pool.blocks.push_back(std::move(block));
+        }
+
+        node->queued.store(true, std::memory_order_relaxed);
+        node->fn = std::move(fn);
+        s_main_queues[(size_t)priority].push(node);
     }
 
     void TaskSystem::pump_main() {
         if (!s_initialized)
             return;
 
-        std::vector<std::function<void()>> local;
-        {
-            std::lock_guard<std::mutex> lock(s_main_mutex);
-            local.swap(s_main_queue);
-        }
+        HN_PROFILE_FUNCTION();
+        Timer timer;
+        uint32_t executed = 0;
+
+        auto run = [&executed](MainNode* node) {
+            node->fn();
+            finish_main_node(node);
+            ++executed;
+        };
+
+        while (MainNode* node = s_main_queues[(size_t)MainPriority::high].pop())
+            run(node);
 
-        for (auto& fn : local) {
-            if (fn) fn();
+        // Work queued by a task that runs here lands behind it and is picked up in the same pass
+        // if the budget allows.
+        bool budget_spent = false;
+        bool ran_budgeted = false;
+        for (size_t priority = (size_t)MainPriority::normal; priority < (size_t)MainPriority::count && !budget_spent; ++priority) {
+            while (true) {
+                if (ran_budgeted && timer.elapsed_millis() >= s_main_budget_ms) {
+                    budget_spent = true;
+                    break;
+                }
+                MainNode* node = s_main_queues[priority].pop();
+                if (!node)
+                    break;
+                run(node);
+                ran_budgeted = true;
+            }
         }
+
+        s_main_stats.executed = executed;
+        s_main_stats.pump_ms = timer.elapsed_millis();
+        s_main_stats.budget_ms = s_main_budget_ms;
+    }
+
+    MainQueueStats TaskSystem::get_main_stats() {
+        MainQueueStats stats = s_main_stats;
+        for (size_t priority = 0; priority < (size_t)MainPriority::count; ++priority)
+            stats.depth[priority] = s_main_queues[priority].depth();
+        return stats;
     }
 
 }
\ No newline at end of file
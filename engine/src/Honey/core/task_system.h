@@ -1,87 +1,258 @@
 #pragma once
 
 #include <TaskScheduler.h>
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "Honey/core/inline_function.h"
 
 namespace Honey {
 
-    struct TaskHandle {
-        enki::ITaskSet* internal = nullptr;
+    // Work for one partition, [start, end) in the caller's index space.
+    using TaskRangeFunction = InlineFunction<void(uint32_t, uint32_t)>;
+
+    // enkiTS priority a task is queued at: a worker takes frame-critical work before normal work,
+    // and background work only when nothing else is queued. Background work may also occupy at
+    // most TaskSystem::set_background_worker_limit workers at once.
+    enum class TaskLane : uint8_t {
+        frame_critical = 0,  // needed this frame: physics jobs, render submission, update stages
+        normal,
+        background,          // asset streaming and other I/O-bound work
+    };
+
+    namespace detail {
+        inline enki::TaskPriority to_enki_priority(TaskLane lane) {
+            switch (lane) {
+                case TaskLane::frame_critical: return enki::TASK_PRIORITY_HIGH;
+                case TaskLane::normal:         return enki::TASK_PRIORITY_MED;
+                case TaskLane::background:     return enki::TASK_PRIORITY_LOW;
+            }
+            return enki::TASK_PRIORITY_MED;
+        }
+
+        // Runs a partition through func, which takes either the range or a single index.
+        template<typename Func>
+        void invoke_range(Func& func, uint32_t start, uint32_t end) {
+            if constexpr (std::is_invocable_v<Func&, uint32_t, uint32_t>) {
+                func(start, end);
+            } else {
+                for (uint32_t i = start; i < end; ++i)
+                    func(i);
+            }
+        }
+
+        // Smallest partition that splits count indices into at most `partitions` pieces, and no
+        // smaller than min_range.
+        inline uint32_t capped_min_range(uint32_t count, uint32_t min_range, uint32_t partitions) {
+            const uint32_t range = partitions ? (count + partitions - 1) / partitions : count;
+            return std::max({ min_range, range, 1u });
+        }
+
+        // Background work held back until it is granted background worker slots. It starts with
+        // at most granted_slots partitions, so it never occupies more workers than that, and hands
+        // the slots back through TaskSystem::release_background_slots once it is done.
+        struct BackgroundWork {
+            uint32_t wanted_slots = 1;
+            uint32_t granted_slots = 0;
+
+            virtual void start_background() = 0;
+
+        protected:
+            ~BackgroundWork() = default;
+        };
+
+        // enkiTS task drawn from the submitting thread's pool. The slot is reused once enkiTS
+        // reports it complete and no TaskHandle refers to it any more.
+        struct PooledTask final : enki::ITaskSet, BackgroundWork {
+            TaskRangeFunction fn;
+            uint32_t base = 0;
+            uint32_t min_range = 1;
+            TaskLane lane = TaskLane::normal;
+            std::atomic<bool> held{ false };
+            // Background task waiting for a free background worker; not in enkiTS' pipe yet.
+            std::atomic<bool> deferred{ false };
+            // Background only: indices still to run. The partition that takes it to zero returns
+            // the task's background slots.
+            std::atomic<uint32_t> remaining{ 0 };
+
+            void ExecuteRange(enki::TaskSetPartition range, uint32_t) override;
+            void start_background() override;
+        };
+    }
+
+    // Refers to a submitted task until TaskSystem::wait, or until it is destroyed. Dropping a
+    // handle without waiting detaches the task: it still runs, and its slot returns to the pool
+    // once it is done.
+    class TaskHandle {
+    public:
+        TaskHandle() = default;
+        TaskHandle(TaskHandle&& other) noexcept
+            : m_task(other.m_task), m_generation(other.m_generation) { other.m_task = nullptr; }
+        TaskHandle& operator=(TaskHandle&& other) noexcept {
+            if (this != &other) {
+                release();
+                m_task = other.m_task;
+                m_generation = other.m_generation;
+                other.m_task = nullptr;
+            }
+            return *this;
+        }
+        TaskHandle(const TaskHandle&) = delete;
+        TaskHandle& operator=(const TaskHandle&) = delete;
+        ~TaskHandle() { release(); }
+
+        explicit operator bool() const noexcept { return m_task != nullptr; }
+
+    private:
+        void release();
+
+        detail::PooledTask* m_task = nullptr;
+        uint32_t m_generation = 0;
+
+        friend class TaskSystem;
+    };
+
+    // Work queued for the main thread.
+    using MainTask = InlineFunction<void()>;
 
-        explicit operator bool() const noexcept { return internal != nullptr; }
+    // Order in which pump_main drains the main-thread queues. `high` work always runs in the
+    // frame it was queued for; `normal` and `low` work shares the per-frame budget, and what does
+    // not fit waits for the next frame.
+    enum class MainPriority : uint8_t {
+        high = 0,
+        normal,
+        low,    // asset finalizers and uploads
+        count,
     };
 
+    struct MainQueueStats {
+        uint32_t depth[(size_t)MainPriority::count] = {};  // queued right now
+        uint32_t executed = 0;                              // run by the last pump
+        float pump_ms = 0.0f;
+        float budget_ms = 0.0f;
+    };
+
+    // Tasks come from per-thread pools and carry their callable inline (TaskRangeFunction), so
+    // submitting one allocates nothing once a thread's pool has warmed up.
     class TaskSystem {
     public:
         static void init();
         static void shutdown();
+        static bool is_initialized() { return s_initialized; }
 
         static enki::TaskScheduler& raw();
 
-        static TaskHandle run_async(std::function<void()> fn);
-        static void wait(TaskHandle handle);
+        template<typename Func>
+        static TaskHandle run_async(Func&& fn, TaskLane lane = TaskLane::normal);
+        // Blocks until the task has run, then empties the handle. The caller helps with queued work
+        // in the meantime, but only with tasks in the same lane or a more urgent one.
+        static void wait(TaskHandle& handle);
         static void wait_for_all();
 
-        static void enqueue_main(std::function<void()> fn);
+        // Lock-free and callable from any thread; the task runs on the next pump_main that has
+        // room for it. Queue nodes come from per-thread pools, so this allocates nothing once the
+        // calling thread's pool has warmed up.
+        static void enqueue_main(MainTask fn, MainPriority priority = MainPriority::normal);
+        // Runs queued main-thread work: all `high` tasks, then `normal` and `low` ones until the
+        // budget is spent. At least one budgeted task runs per call, so a task longer than the
+        // budget still gets through.
         static void pump_main();
+        static void set_main_budget(float milliseconds) { s_main_budget_ms = milliseconds; }
+        static MainQueueStats get_main_stats();
 
+        // Splits [begin, end) into partitions of at least minBatchSize indices. `func` takes a
+        // partition as (start, end); a callable taking a single index is also accepted and is
+        // looped over each partition. An lvalue callable is referenced rather than copied, so it
+        // must outlive the task. In the background lane the range is split into no more partitions
+        // than the task was granted background workers.
         template<typename Func>
         static TaskHandle parallel_for(uint32_t begin,
                                        uint32_t end,
                                        Func&& func,
-                                       uint32_t minBatchSize = 64);
+                                       uint32_t minBatchSize = 64,
+                                       TaskLane lane = TaskLane::normal);
+
+        // How many workers background work may occupy at once. A background task is granted up to
+        // one worker per partition while workers are free, and queues up while none are; it keeps
+        // its grant until it is done. Defaults to half the workers.
+        static void set_background_worker_limit(uint32_t limit);
+        static uint32_t get_background_worker_limit() { return s_background_limit; }
 
     private:
+        static TaskHandle submit(TaskRangeFunction fn, uint32_t begin, uint32_t count, uint32_t min_range,
+                                 TaskLane lane);
+        static detail::PooledTask* acquire_task();
+
+        // Starts background work with as many of its wanted slots as are free, or queues it while
+        // none are. Work that started hands its granted slots back with release_background_slots
+        // once it is done.
+        static void submit_background(detail::BackgroundWork* work, std::atomic<bool>* deferred);
+        static void release_background_slots(uint32_t slots);
+        // Starts queued background work while slots are free.
+        static void start_background_backlog();
+        // Takes a still-queued pooled task back out of the backlog; false once it has been piped.
+        static bool take_deferred(detail::PooledTask* task);
+
         static inline enki::TaskScheduler s_scheduler{};
         static inline bool s_initialized = false;
+        // Bumped by shutdown, which frees the task pools; stale handles and thread-local pool
+        // pointers from an earlier init are recognized by it.
+        static inline uint32_t s_generation = 1;
+
+        static inline float s_main_budget_ms = 4.0f;
 
-        static inline std::mutex s_main_mutex{};
-        static inline std::vector<std::function<void()>> s_main_queue;
+        struct DeferredTask {
+            detail::BackgroundWork* work;
+            std::atomic<bool>* deferred;
+        };
+        static inline std::mutex s_background_mutex{};
+        static inline std::deque<DeferredTask> s_background_backlog;
+        static inline uint32_t s_background_running = 0;
+        static inline uint32_t s_background_limit = 1;
+
+        friend class TaskHandle;
+        friend class TaskGraph;
+        friend struct detail::PooledTask;
     };
 
 
+    template<typename Func>
+    TaskHandle TaskSystem::run_async(Func&& fn, TaskLane lane) {
+        if (!s_initialized)
+            return {};
+
+        // Single partition – just run fn() once on some worker
+        return submit([fn = std::forward<Func>(fn)](uint32_t, uint32_t) mutable { fn(); }, 0, 1, 1, lane);
+    }
+
     template<typename Func>
     TaskHandle TaskSystem::parallel_for(uint32_t begin,
                                         uint32_t end,
                                         Func&& func,
-                                        uint32_t minBatchSize)
+                                        uint32_t minBatchSize,
+                                        TaskLane lane)
     {
         if (!s_initialized || begin >= end) {
             return {};
         }
 
-        // Small adapter that forwards range indices [start, end) to a lambda
-        struct LambdaTaskSet : enki::ITaskSet {
-            Func        func;
-            uint32_t    begin;
-            uint32_t    end;
-
-            LambdaTaskSet(Func&& f, uint32_t b, uint32_t e, uint32_t setSize)
-                : enki::ITaskSet(setSize), func(std::forward<Func>(f)), begin(b), end(e) {}
-
-            void ExecuteRange(enki::TaskSetPartition range, uint32_t) override {
-                // enkiTS gives us [start, end) in the same index space
-                for (uint32_t i = range.start; i < range.end; ++i) {
-                    func(i);
-                }
-            }
-        };
-
-        const uint32_t total = end - begin;
-        if (total == 0)
-            return {};
-
-        // Choose a reasonable number of partitions based on minBatchSize
+        // minBatchSize becomes enkiTS' minimum range, so no partition is smaller than that
         const uint32_t batchSize = (minBatchSize == 0) ? 1u : minBatchSize;
-        const uint32_t desiredPartitions = (total + batchSize - 1u) / batchSize;
-        const uint32_t partitions = desiredPartitions > 0 ? desiredPartitions : 1u;
-
-        // Allocate on the heap; TaskSystem::wait() will delete it.
-        auto* task = new LambdaTaskSet(std::forward<Func>(func), begin, end, partitions);
 
-        s_scheduler.AddTaskSetToPipe(task);
-        return TaskHandle{ task };
+        if constexpr (std::is_lvalue_reference_v<Func>) {
+            auto* f = &func;
+            return submit([f](uint32_t start, uint32_t stop) { detail::invoke_range(*f, start, stop); },
+                          begin, end - begin, batchSize, lane);
+        } else {
+            return submit([f = std::move(func)](uint32_t start, uint32_t stop) mutable { detail::invoke_range(f, start, stop); },
+                          begin, end - begin, batchSize, lane);
+        }
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,566 @@
+#include "hnpch.h"
+#include "benchmarks.h"
+
+#include "Honey/core/task_system.h"
+#include "Honey/core/timer.h"
+#include "Honey/physics/physics_engine_3d.h"
+#include "Honey/scene/dynamic_aabb_tree.h"
+#include "Honey/scene/entity.h"
+#include "Honey/scene/scene.h"
+#include "Honey/scene/scene_serializer.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <filesystem>
+#include <functional>
+#include <random>
+
+namespace Honey::Benchmarks {
+
+    namespace {
+        // Keeps the optimizer from discarding lookups whose result is unused.
+        volatile uint64_t s_sink = 0;
+
+        // Brings the TaskSystem up for the benchmark's lifetime unless the host already did.
+        struct ScopedTaskSystem {
+            bool owned = !TaskSystem::is_initialized();
+            ScopedTaskSystem() { if (owned) TaskSystem::init(); }
+            ~ScopedTaskSystem() { if (owned) TaskSystem::shutdown(); }
+        };
+
+        // What TaskSystem::run_async used to allocate per call.
+        struct HeapFunctionTask final : enki::ITaskSet {
+            std::function<void()> fn;
+            explicit HeapFunctionTask(std::function<void()> f) : fn(std::move(f)) {}
+            void ExecuteRange(enki::TaskSetPartition, uint32_t) override { fn(); }
+        };
+
+        // Builds root_count chains, each with `depth` levels below the root and
+        // `fanout` children per node on the first level (fanout 1 = plain chains).
+        std::vector<Entity> build_hierarchy(Scene& scene, uint32_t root_count, uint32_t fanout, uint32_t depth) {
+            std::vector<Entity> roots;
+            roots.reserve(root_count);
+
+            for (uint32_t r = 0; r < root_count; ++r) {
+                Entity root = scene.create_entity("Root");
+                roots.push_back(root);
+
+                for (uint32_t f = 0; f < fanout; ++f) {
+                    Entity parent = root;
+                    for (uint32_t d = 0; d < depth; ++d) {
+                        Entity child = scene.create_entity("Node");
+                        child.get_component<TransformComponent>().translation = { 1.0f, 0.0f, 0.0f };
+                        child.set_parent(parent, false);
+                        parent = child;
+                    }
+                }
+            }
+            return roots;
+        }
+
+        void time_transform_updates(const char* label, Scene& scene, const std::vector<Entity>& roots, uint32_t iterations) {
+            EditorCamera camera;
+
+            Timer timer;
+            scene.on_update_editor(Timestep(0.0f), camera); // rebuilds the order, everything dirty
+            const float first_ms = timer.elapsed_millis();
+
+            timer.reset();
+            for (uint32_t i = 0; i < iterations; ++i) {
+                for (Entity root : roots) {
+                    auto& tc = root.get_component<TransformComponent>();
+                    tc.translation.y += 0.01f;
+                    scene.mark_transform_dirty(root);
+                }
+                scene.on_update_editor(Timestep(0.0f), camera);
+            }
+            const float moving_ms = timer.elapsed_millis() / (float)iterations;
+
+            timer.reset();
+            for (uint32_t i = 0; i < iterations; ++i)
+                scene.on_update_editor(Timestep(0.0f), camera);
+            const float static_ms = timer.elapsed_millis() / (float)iterations;
+
+            HN_CORE_INFO("  {:<6} {:>7} nodes: rebuild+full {:.3f} ms, all roots moved {:.3f} ms, static {:.3f} ms",
+                         label, scene.get_registry().view<TransformComponent>().size(),
+                         first_ms, moving_ms, static_ms);
+        }
+    }
+
+    void scene_uuid_lookup(uint32_t lookups) {
+        HN_CORE_INFO("[Benchmark] Scene UUID lookup ({} lookups per run)", lookups);
+
+        for (uint32_t entity_count : { 1000u, 10000u, 100000u }) {
+            Scene scene;
+            std::vector<UUID> ids;
+            ids.reserve(entity_count);
+            for (uint32_t i = 0; i < entity_count; ++i)
+                ids.push_back(scene.create_entity("Bench").get_uuid());
+
+            std::mt19937 rng(1234);
+            std::uniform_int_distribution<uint32_t> pick(0, entity_count - 1);
+            std::vector<UUID> queries;
+            queries.reserve(lookups);
+            for (uint32_t i = 0; i < lookups; ++i)
+                queries.push_back(ids[pick(rng)]);
+
+            Timer timer;
+            for (UUID id : queries)
+                s_sink = s_sink + (uint32_t)scene.get_entity(id);
+            const float indexed_ms = timer.elapsed_millis();
+
+            // Linear scan is O(n) per lookup; cap the sample so the large runs finish.
+            const uint32_t scan_lookups = std::min<uint32_t>(lookups, 1000);
+            auto& registry = scene.get_registry();
+            auto view = registry.view<IDComponent>();
+            timer.reset();
+            for (uint32_t i = 0; i < scan_lookups; ++i) {
+                for (auto e : view) {
+                    if (view.get<IDComponent>(e).id == queries[i]) {
+                        s_sink = s_sink + (uint32_t)e;
+                        break;
+                    }
+                }
+            }
+            const float scan_ms = timer.elapsed_millis();
+
+            HN_CORE_INFO("  {:>7} entities: indexed {:.1f} ns/lookup, linear scan {:.1f} ns/lookup",
+                         entity_count,
+                         indexed_ms * 1.0e6f / (float)lookups,
+                         scan_ms * 1.0e6f / (float)scan_lookups);
+        }
+    }
+
+    void scene_transform_propagation(uint32_t iterations) {
+        ScopedTaskSystem tasks;
+        HN_CORE_INFO("[Benchmark] World transform propagation ({} workers, {} iterations)",
+                     TaskSystem::raw().GetNumTaskThreads(), iterations);
+
+        {
+            Scene scene;
+            auto roots = build_hierarchy(scene, 16, 6250, 1);
+            time_transform_updates("wide", scene, roots, iterations);
+        }
+        {
+            Scene scene;
+            auto roots = build_hierarchy(scene, 4096, 1, 24);
+            time_transform_updates("deep", scene, roots, iterations);
+        }
+    }
+
+    void scene_hierarchy_churn(uint32_t edits_per_frame, uint32_t iterations) {
+        ScopedTaskSystem tasks;
+        HN_CORE_INFO("[Benchmark] Hierarchy churn ({} spawns/reparents/destroys per frame, {} iterations)",
+                     edits_per_frame, iterations);
+
+        Scene scene;
+        auto roots = build_hierarchy(scene, 16, 6250, 1);
+        EditorCamera camera;
+        scene.on_update_editor(Timestep(0.0f), camera); // initial order build
+
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<size_t> pick_root(0, roots.size() - 1);
+        std::vector<Entity> spawned;
+
+        Timer timer;
+        for (uint32_t i = 0; i < iterations; ++i) {
+            for (uint32_t n = 0; n < edits_per_frame; ++n) {
+                Entity e = scene.create_entity("Spawned");
+                e.set_parent(roots[pick_root(rng)], false);
+                spawned.push_back(e);
+            }
+            for (uint32_t n = 0; n < edits_per_frame && !spawned.empty(); ++n) {
+                std::uniform_int_distribution<size_t> pick(0, spawned.size() - 1);
+                spawned[pick(rng)].set_parent(roots[pick_root(rng)], false);
+            }
+            for (uint32_t n = 0; n < edits_per_frame / 2 && !spawned.empty(); ++n) {
+                std::uniform_int_distribution<size_t> pick(0, spawned.size() - 1);
+                const size_t idx = pick(rng);
+                scene.destroy_entity(spawned[idx]);
+                spawned[idx] = spawned.back();
+                spawned.pop_back();
+            }
+            scene.on_update_editor(Timestep(0.0f), camera);
+        }
+        const float frame_ms = timer.elapsed_millis() / (float)iterations;
+
+        HN_CORE_INFO("  {:>7} nodes: {:.3f} ms/frame including edits",
+                     scene.get_registry().view<TransformComponent>().size(), frame_ms);
+    }
+
+    void spatial_tree(uint32_t entity_count, uint32_t iterations) {
+        HN_CORE_INFO("[Benchmark] Dynamic AABB tree ({} entities, {} iterations)", entity_count, iterations);
+
+        // Unit-ish boxes scattered over a 1 km square, 50 m tall.
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> pos_xz(-500.0f, 500.0f);
+        std::uniform_real_distribution<float> pos_y(0.0f, 50.0f);
+        std::uniform_real_distribution<float> size(0.25f, 2.0f);
+        std::uniform_real_distribution<float> step(-0.2f, 0.2f);
+
+        std::vector<Math::AABB> boxes(entity_count);
+        for (auto& box : boxes) {
+            const glm::vec3 c(pos_xz(rng), pos_y(rng), pos_xz(rng));
+            const glm::vec3 h(size(rng) * 0.5f);
+            box = { c - h, c + h };
+        }
+
+        DynamicAABBTree tree;
+        std::vector<int32_t> proxies(entity_count);
+
+        Timer timer;
+        for (uint32_t i = 0; i < entity_count; ++i)
+            proxies[i] = tree.create_proxy(boxes[i], (entt::entity)i);
+        const float insert_ms = timer.elapsed_millis();
+
+        // Every entity moves a little each frame; fat margins absorb most of it.
+        uint32_t reinserts = 0;
+        timer.reset();
+        for (uint32_t it = 0; it < iterations; ++it) {
+            for (uint32_t i = 0; i < entity_count; ++i) {
+                const glm::vec3 d(step(rng), step(rng), step(rng));
+                boxes[i].min += d;
+                boxes[i].max += d;
+                reinserts += tree.move_proxy(proxies[i], boxes[i]) ? 1 : 0;
+            }
+        }
+        const float move_ms = timer.elapsed_millis() / (float)iterations;
+
+        // Queries against the (now churned) tree vs. a linear scan over the same boxes.
+        constexpr uint32_t k_queries = 1000;
+        std::vector<glm::vec3> centers(k_queries);
+        for (auto& c : centers)
+            c = { pos_xz(rng), pos_y(rng), pos_xz(rng) };
+
+        uint64_t tree_hits = 0;
+        timer.reset();
+        for (const auto& c : centers)
+            tree.query_sphere(c, 10.0f, [&](entt::entity) { ++tree_hits; return true; });
+        const float sphere_ms = timer.elapsed_millis();
+
+        uint64_t scan_hits = 0;
+        timer.reset();
+        for (const auto& c : centers) {
+            for (const auto& box : boxes)
+                scan_hits += box.overlaps_sphere(c, 10.0f) ? 1 : 0;
+        }
+        const float scan_ms = timer.elapsed_millis();
+
+        // Roughly a 60-degree camera looking across the field.
+        const glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 20.0f, -520.0f), glm::vec3(0.0f, 10.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::mat4 proj = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 400.0f);
+        const Math::Frustum frustum = Math::Frustum::from_view_projection(proj * view);
+        uint64_t frustum_hits = 0;
+        timer.reset();
+        for (uint32_t it = 0; it < iterations; ++it)
+            tree.query(frustum, [&](entt::entity) { ++frustum_hits; return true; });
+        const float frustum_ms = timer.elapsed_millis() / (float)iterations;
+
+        uint64_t ray_hits = 0;
+        timer.reset();
+        for (const auto& c : centers) {
+            const glm::vec3 origin(c.x, 100.0f, c.z);
+            tree.raycast(origin, glm::vec3(0.0f, -1.0f, 0.0f), 200.0f, [&](entt::entity, float t) { ++ray_hits; return t; });
+        }
+        const float ray_ms = timer.elapsed_millis();
+
+        s_sink = s_sink + tree_hits + scan_hits + frustum_hits + ray_hits;
+
+        HN_CORE_INFO("  insert {:.2f} ms ({:.0f} ns/proxy), tree height {}",
+                     insert_ms, insert_ms * 1.0e6f / (float)entity_count, tree.get_height());
+        HN_CORE_INFO("  all moving: {:.2f} ms/frame, {:.1f}% reinserted",
+                     move_ms, 100.0f * (float)reinserts / (float)(entity_count * iterations));
+        HN_CORE_INFO("  sphere r=10: tree {:.2f} us/query, linear scan {:.2f} us/query ({} hits)",
+                     sphere_ms * 1.0e3f / (float)k_queries, scan_ms * 1.0e3f / (float)k_queries, tree_hits);
+        HN_CORE_INFO("  frustum: {:.3f} ms/query ({} visible), ray: {:.2f} us/query",
+                     frustum_ms, frustum_hits / iterations, ray_ms * 1.0e3f / (float)k_queries);
+    }
+
+    void scene_load_formats(uint32_t entity_count, uint32_t iterations) {
+        HN_CORE_INFO("[Benchmark] Scene load: YAML vs binary runtime format ({} entities, {} iterations)",
+                     entity_count, iterations);
+
+        const std::filesystem::path dir = std::filesystem::temp_directory_path() / "honey_scene_load_bench";
+        const std::filesystem::path yaml_path = dir / "scene.hnscene";
+        const std::filesystem::path binary_path = dir / "scene.hnsb";
+
+        {
+            Ref<Scene> source = CreateRef<Scene>();
+            std::mt19937 rng(1234);
+            std::uniform_real_distribution<float> pos(-100.0f, 100.0f);
+
+            // Groups of one root and seven children, with a spread of component types.
+            Entity root;
+            for (uint32_t i = 0; i < entity_count; ++i) {
+                Entity e = source->create_entity("Entity " + std::to_string(i));
+                auto& tc = e.get_component<TransformComponent>();
+                tc.translation = { pos(rng), pos(rng), pos(rng) };
+                tc.rotation    = { 0.0f, pos(rng) * 0.01f, 0.0f };
+
+                if (i % 8 == 0)
+                    root = e;
+                else
+                    e.set_parent(root, false);
+
+                if (i % 4 == 0) {
+                    auto& light = e.add_component<PointLightComponent>();
+                    light.range = 5.0f + (float)(i % 16);
+                }
+                if (i % 2 == 1) {
+                    e.add_component<RigidbodyComponent>().body_type = RigidbodyComponent::BodyType::Dynamic;
+                    e.add_component<BoxCollider3DComponent>().half_size = { 0.5f, 1.0f, 0.5f };
+                }
+                if (i % 8 == 3) {
+                    auto& sc = e.add_component<ScriptComponent>();
+                    sc.script_name = "Game.Enemy";
+                    sc.property_overrides["Speed"]   = 2.5f;
+                    sc.property_overrides["Boss"]    = (i % 64 == 3);
+                    sc.property_overrides["Loadout"] = std::string("rifle");
+                }
+                if (i % 8 == 5) {
+                    auto& text = e.add_component<TextRendererComponent>();
+                    text.text      = "Label " + std::to_string(i);
+                    text.font_path = "assets/fonts/default.ttf";
+                }
+            }
+
+            SceneSerializer serializer(source);
+            serializer.serialize(yaml_path);
+            serializer.serialize_runtime(binary_path);
+        }
+
+        auto time_load = [&](bool binary) {
+            float total_ms = 0.0f;
+            size_t loaded = 0;
+            for (uint32_t i = 0; i < iterations; ++i) {
+                Ref<Scene> scene = CreateRef<Scene>();
+                SceneSerializer serializer(scene);
+
+                Timer timer;
+                const bool ok = binary ? serializer.deserialize_runtime(binary_path)
+                                       : serializer.deserialize(yaml_path);
+                total_ms += timer.elapsed_millis();
+
+                if (ok)
+                    loaded = scene->get_registry().view<IDComponent>().size();
+            }
+            return std::make_pair(total_ms / (float)iterations, loaded);
+        };
+
+        const auto [yaml_ms, yaml_entities] = time_load(false);
+        const auto [binary_ms, binary_entities] = time_load(true);
+
+        HN_CORE_INFO("  yaml   {:>9} bytes: {:.2f} ms/load ({} entities)",
+                     std::filesystem::file_size(yaml_path), yaml_ms, yaml_entities);
+        HN_CORE_INFO("  binary {:>9} bytes: {:.2f} ms/load ({} entities), {:.1f}x faster",
+                     std::filesystem::file_size(binary_path), binary_ms, binary_entities,
+                     binary_ms > 0.0f ? yaml_ms / binary_ms : 0.0f);
+
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    void scene_snapshot(uint32_t entity_count, uint32_t iterations) {
+        ScopedTaskSystem tasks;
+        HN_CORE_INFO("[Benchmark] Play-mode snapshot ({} entities, {} iterations)", entity_count, iterations);
+
+        Ref<Scene> editor_scene = CreateRef<Scene>();
+        const uint32_t root_count = std::max(1u, entity_count / 1000);
+        build_hierarchy(*editor_scene, root_count, 1000 - 1, 1);
+
+        auto view = editor_scene->get_registry().view<TransformComponent>();
+        uint32_t i = 0;
+        for (auto e : view) {
+            Entity entity{ e, editor_scene.get() };
+            if (i % 4 == 0)
+                entity.add_component<PointLightComponent>();
+            if (i % 2 == 1)
+                entity.add_component<BoxCollider3DComponent>();
+            ++i;
+        }
+
+        EditorCamera camera;
+        editor_scene->on_update_editor(Timestep(0.0f), camera);
+
+        float copy_ms = 0.0f, first_update_ms = 0.0f, restore_ms = 0.0f;
+        for (uint32_t it = 0; it < iterations; ++it) {
+            Timer timer;
+            Ref<Scene> runtime_scene = Scene::copy(editor_scene);
+            copy_ms += timer.elapsed_millis();
+
+            timer.reset();
+            runtime_scene->on_update_editor(Timestep(0.0f), camera);
+            first_update_ms += timer.elapsed_millis();
+
+            // Play in place, then roll back.
+            timer.reset();
+            editor_scene->restore(*runtime_scene);
+            restore_ms += timer.elapsed_millis();
+        }
+
+        HN_CORE_INFO("  {:>7} entities: copy {:.2f} ms, first update {:.2f} ms, restore {:.2f} ms",
+                     editor_scene->get_registry().view<IDComponent>().size(),
+                     copy_ms / (float)iterations, first_update_ms / (float)iterations, restore_ms / (float)iterations);
+    }
+
+    void physics_3d_start(uint32_t body_count, uint32_t iterations) {
+        ScopedTaskSystem tasks;
+        HN_CORE_INFO("[Benchmark] 3D physics start ({} bodies, best of {} iterations)", body_count, iterations);
+
+        Ref<Scene> scene = CreateRef<Scene>();
+        const uint32_t side = (uint32_t)std::ceil(std::cbrt((double)body_count));
+        std::vector<Entity> entities;
+        entities.reserve(body_count);
+        for (uint32_t i = 0; i < body_count; ++i) {
+            Entity entity = scene->create_entity("Body");
+            entity.get_component<TransformComponent>().translation =
+                { (float)(i % side) * 2.0f, (float)(i / (side * side)) * 2.0f, (float)((i / side) % side) * 2.0f };
+
+            auto& rb = entity.add_component<RigidbodyComponent>();
+            rb.body_type = (i % 10 == 0) ? RigidbodyComponent::BodyType::Static : RigidbodyComponent::BodyType::Dynamic;
+            if (i % 3 == 0)
+                entity.add_component<SphereCollider3DComponent>().radius = 0.25f + 0.25f * (float)(i % 2);
+            else
+                entity.add_component<BoxCollider3DComponent>().half_size = glm::vec3(0.25f + 0.125f * (float)(i % 4));
+            entities.push_back(entity);
+        }
+
+        auto& engine = PhysicsEngine3D::get();
+        const float step = 1.0f / 60.0f;
+
+        Ref<Scene> empty_scene = CreateRef<Scene>();
+        float single_ms = FLT_MAX, single_step_ms = FLT_MAX;
+        float bulk_ms = FLT_MAX, bulk_step_ms = FLT_MAX;
+        uint32_t bodies = 0;
+
+        // Baseline: an empty world, then one create_body (one AddBody) per entity.
+        auto run_single = [&]() {
+            Timer timer;
+            engine.on_scene_start(empty_scene.get());
+            for (Entity entity : entities)
+                engine.create_body(entity);
+            single_ms = std::min(single_ms, timer.elapsed_millis());
+            timer.reset();
+            engine.step(step);
+            single_step_ms = std::min(single_step_ms, timer.elapsed_millis());
+            engine.on_scene_stop();
+        };
+
+        auto run_bulk = [&]() {
+            Timer timer;
+            engine.on_scene_start(scene.get());
+            bulk_ms = std::min(bulk_ms, timer.elapsed_millis());
+            timer.reset();
+            engine.step(step);
+            bulk_step_ms = std::min(bulk_step_ms, timer.elapsed_millis());
+            bodies = engine.get_body_count();
+            engine.on_scene_stop();
+        };
+
+        for (uint32_t it = 0; it < std::max(iterations, 1u); ++it) {
+            if (it % 2 == 0) {
+                run_single();
+                run_bulk();
+            } else {
+                run_bulk();
+                run_single();
+            }
+        }
+
+        HN_CORE_INFO("  one at a time: start {:.2f} ms, first step {:.2f} ms", single_ms, single_step_ms);
+        HN_CORE_INFO("  bulk {:>7} bodies: start {:.2f} ms, first step {:.2f} ms, {:.1f}x faster start",
+                     bodies, bulk_ms, bulk_step_ms, bulk_ms > 0.0f ? single_ms / bulk_ms : 0.0f);
+    }
+
+    void task_dispatch(uint32_t tasks, uint32_t iterations) {
+        ScopedTaskSystem scope;
+        HN_CORE_INFO("[Benchmark] Task dispatch ({} tasks, {} iterations)", tasks, iterations);
+
+        enki::TaskScheduler& scheduler = TaskSystem::raw();
+        std::atomic<uint64_t> counter{ 0 };
+        const double scale = 1.0e6 / ((double)tasks * (double)iterations); // ms total -> ns per task
+
+        double heap_ms = 0.0, pooled_ms = 0.0, burst_ms = 0.0, parallel_ms = 0.0;
+        for (uint32_t it = 0; it < iterations; ++it) {
+            Timer timer;
+            for (uint32_t i = 0; i < tasks; ++i) {
+                auto* task = new HeapFunctionTask([&counter, a = (uint64_t)i, b = (uint64_t)it, c = 0.5f]() {
+                    counter.fetch_add(a + b + (uint64_t)c, std::memory_order_relaxed);
+                });
+                scheduler.AddTaskSetToPipe(task);
+                scheduler.WaitforTask(task);
+                delete task;
+            }
+            heap_ms += timer.elapsed_millis();
+
+            timer.reset();
+            for (uint32_t i = 0; i < tasks; ++i) {
+                TaskHandle handle = TaskSystem::run_async([&counter, a = (uint64_t)i, b = (uint64_t)it, c = 0.5f]() {
+                    counter.fetch_add(a + b + (uint64_t)c, std::memory_order_relaxed);
+                });
+                TaskSystem::wait(handle);
+            }
+            pooled_ms += timer.elapsed_millis();
+
+            timer.reset();
+            for (uint32_t i = 0; i < tasks; ++i) {
+                TaskSystem::run_async([&counter, a = (uint64_t)i, b = (uint64_t)it, c = 0.5f]() {
+                    counter.fetch_add(a + b + (uint64_t)c, std::memory_order_relaxed);
+                });
+            }
+            TaskSystem::wait_for_all();
+            burst_ms += timer.elapsed_millis();
+
+            timer.reset();
+            for (uint32_t i = 0; i < tasks; ++i) {
+                TaskHandle handle = TaskSystem::parallel_for(0, 1024, [&counter](uint32_t start, uint32_t end) {
+                    counter.fetch_add(end - start, std::memory_order_relaxed);
+                }, 256);
+                TaskSystem::wait(handle);
+            }
+            parallel_ms += timer.elapsed_millis();
+        }
+        s_sink = counter.load();
+
+        HN_CORE_INFO("  heap task + std::function: {:.0f} ns/task (run + wait)", heap_ms * scale);
+        HN_CORE_INFO("  pooled run_async:          {:.0f} ns/task (run + wait), {:.0f} ns/task fire-and-forget",
+                     pooled_ms * scale, burst_ms * scale);
+        HN_CORE_INFO("  pooled parallel_for:       {:.0f} ns/call (1024 indices, 256 per range)", parallel_ms * scale);
+    }
+
+    namespace {
+        struct NamedBenchmark {
+            std::string_view name;
+            void (*fn)();
+        };
+
+        constexpr NamedBenchmark k_benchmarks[] = {
+            { "scene_uuid_lookup",           [] { scene_uuid_lookup(); } },
+            { "scene_transform_propagation", [] { scene_transform_propagation(); } },
+            { "scene_hierarchy_churn",       [] { scene_hierarchy_churn(); } },
+            { "spatial_tree",                [] { spatial_tree(); } },
+            { "scene_load_formats",          [] { scene_load_formats(); } },
+            { "scene_snapshot",              [] { scene_snapshot(); } },
+            { "physics_3d_start",            [] { physics_3d_start(); } },
+            { "task_dispatch",               [] { task_dispatch(); } },
+        };
+    }
+
+    void run_all() {
+        for (const NamedBenchmark& benchmark : k_benchmarks)
+            benchmark.fn();
+    }
+
+    bool run(std::string_view name) {
+        for (const NamedBenchmark& benchmark : k_benchmarks) {
+            if (benchmark.name == name) {
+                benchmark.fn();
+                return true;
+            }
+        }
+        return false;
+    }
+
+}
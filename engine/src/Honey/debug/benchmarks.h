@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace Honey::Benchmarks {
+
+    // Headless micro-benchmarks for engine hot paths. Each benchmark builds its
+    // own throwaway Scene, so none of them need a window, renderer or script host.
+    // Results go to the core logger. The `benchmarks` executable runs them.
+
+    // Scene::get_entity(UUID) against the old linear IDComponent scan,
+    // at increasing entity counts. Indexed lookup cost should stay flat.
+    void scene_uuid_lookup(uint32_t lookups = 10000);
+
+    // World transform propagation over synthetic 100k-node hierarchies: one wide
+    // (few roots, huge second level) and one deep (many long chains). Times the
+    // hierarchy rebuild, a frame where every root moved and a frame where nothing did.
+    void scene_transform_propagation(uint32_t iterations = 20);
+
+    // Per-frame spawn/reparent/destroy on top of the wide 100k hierarchy. Hierarchy
+    // edits are spliced into the transform order, so frame cost should track the
+    // number of edits rather than the scene size.
+    void scene_hierarchy_churn(uint32_t edits_per_frame = 64, uint32_t iterations = 20);
+
+    // DynamicAABBTree on 100k boxes: bulk insert, a frame where every box moves, and
+    // sphere / frustum / ray queries (sphere also against a linear scan).
+    void spatial_tree(uint32_t entity_count = 100000, uint32_t iterations = 20);
+
+    // Writes one generated scene (hierarchy, lights, physics, scripts with property overrides)
+    // as YAML and as the binary runtime format, then times loading each into a fresh Scene.
+    // Asset-backed components are left out so the loads stay headless.
+    void scene_load_formats(uint32_t entity_count = 20000, uint32_t iterations = 5);
+
+    // Play/Stop round trip on a wide hierarchy: Scene::copy into a fresh scene, the first
+    // update of the copy (which reuses the source's transform order), and Scene::restore.
+    void scene_snapshot(uint32_t entity_count = 80000, uint32_t iterations = 5);
+
+    // 3D physics start on a scene of mixed boxes and spheres (a handful of distinct sizes):
+    // PhysicsEngine3D::on_scene_start, which adds every body in one batch and rebuilds the
+    // broad phase, against adding the same bodies one create_body at a time. Also times the
+    // first step after each, which pays for an unoptimized broad phase. The two paths swap order
+    // every iteration and the best of each is reported, so neither gains from running warm.
+    void physics_3d_start(uint32_t body_count = 40000, uint32_t iterations = 3);
+
+    // TaskSystem dispatch overhead per task: run_async + wait round trips, fire-and-forget bursts
+    // and small parallel_for calls, against a heap-allocated std::function task (the scheme
+    // TaskSystem used before tasks were pooled). The captures are too big for std::function's
+    // small buffer but fit TaskRangeFunction's.
+    void task_dispatch(uint32_t tasks = 20000, uint32_t iterations = 5);
+
+    void run_all();
+    // Runs one benchmark, named like its function (e.g. "physics_3d_start"), with its default
+    // arguments. False if there is no benchmark by that name.
+    bool run(std::string_view name);
+
+}
@@ -28,6 +28,7 @@
 #include "glm/ext/matrix_transform.hpp"
 #include "glm/gtc/type_ptr.hpp"
 #include "glm/gtx/quaternion.hpp"
+#include "Honey/core/task_graph.h"
 #include "Honey/core/task_system.h"
 
 namespace Honey {
@@ -391,7 +392,7 @@ namespace Honey {
                     if (Renderer::get_api() == RendererAPI::API::vulkan) {
                         Application::get().get_vulkan_backend().enqueue_upload_job(std::move(upload));
                     } else {
-                        TaskSystem::enqueue_main(std::move(upload));
+                        TaskSystem::enqueue_main(std::move(upload), MainPriority::low);
                     }
                 } else {
                     tex = Texture2D::create((uint32_t)w, (uint32_t)h);
@@ -647,6 +648,7 @@ namespace Honey {
                     model, ext.pbr_specular_glossiness.specular_glossiness_texture.gltf_image_source, gltfDir, async, textureCacheByImageIndex, p_tex_mutex);
             }
 
+            mat->mark_dirty();
             return mat;
         }
 
@@ -747,7 +749,9 @@ namespace Honey {
             return glm::translate(glm::mat4(1.0f), t) * glm::toMat4(r) * glm::scale(glm::mat4(1.0f), s);
         }
 
-        static bool parse_gltf_model(const std::filesystem::path& path, tinygltf::Model& out_model) {
+        // Parses the document, leaving images as the compressed bytes from the file; decode them
+        // with decode_gltf_image.
+        static bool parse_gltf_document(const std::filesystem::path& path, tinygltf::Model& out_model) {
             HN_PROFILE_FUNCTION();
             if (!std::filesystem::exists(path)) {
                 HN_CORE_ERROR("glTF: file does not exist: {}", path.string());
@@ -770,7 +774,7 @@ namespace Honey {
 
             bool ok = false;
             {
-                HN_PROFILE_SCOPE("parse_gltf_model::tinygltf_parse");
+                HN_PROFILE_SCOPE("parse_gltf_document::tinygltf_parse");
                 const std::string p = path.string();
                 if (has_ext(path, ".glb")) {
                     ok = loader.LoadBinaryFromFile(&out_model, &err, &warn, p);
@@ -788,25 +792,34 @@ namespace Honey {
                 return false;
             }
 
+            return true;
+        }
+
+        static void decode_gltf_image(tinygltf::Image& img) {
+            if (!img.as_is || img.image.empty()) return;
+            int w = 0, h = 0, comp = 0;
+            unsigned char* px = stbi_load_from_memory(
+                img.image.data(), (int)img.image.size(), &w, &h, &comp, 0);
+            if (!px) return;
+            img.width     = w;
+            img.height    = h;
+            img.component = comp;
+            img.bits      = 8;
+            img.image.assign(px, px + (size_t)w * h * comp);
+            img.as_is     = false;
+            stbi_image_free(px);
+        }
+
+        static bool parse_gltf_model(const std::filesystem::path& path, tinygltf::Model& out_model) {
+            HN_PROFILE_FUNCTION();
+            if (!parse_gltf_document(path, out_model))
+                return false;
+
             if (!out_model.images.empty()) {
                 HN_PROFILE_SCOPE("parse_gltf_model::parallel_image_decode");
                 auto img_handle = TaskSystem::parallel_for(
                     0, (uint32_t)out_model.images.size(),
-                    [&](uint32_t i) {
-                        auto& img = out_model.images[i];
-                        if (!img.as_is || img.image.empty()) return;
-                        int w = 0, h = 0, comp = 0;
-                        unsigned char* px = stbi_load_from_memory(
-                            img.image.data(), (int)img.image.size(), &w, &h, &comp, 0);
-                        if (!px) return;
-                        img.width     = w;
-                        img.height    = h;
-                        img.component = comp;
-                        img.bits      = 8;
-                        img.image.assign(px, px + (size_t)w * h * comp);
-                        img.as_is     = false;
-                        stbi_image_free(px);
-                    }, 1);
+                    [&](uint32_t i) { decode_gltf_image(out_model.images[i]); }, 1);
                 TaskSystem::wait(img_handle);
             }
 
@@ -831,6 +844,7 @@ namespace Honey {
             PendingMaterialPayload material{};
             std::string name;
             glm::mat4 transform{1.0f};
+            Math::AABB bounds;
             std::vector<VertexPBR> vertices;
             std::vector<uint32_t> indices;
             MeshletGeometry meshlets;
@@ -1386,6 +1400,13 @@ namespace Honey {
             return result;
         }
 
+        static Math::AABB compute_local_bounds(const std::vector<VertexPBR>& vertices) {
+            Math::AABB bounds;
+            for (const auto& v : vertices)
+                bounds.expand(glm::vec3(v.position));
+            return bounds;
+        }
+
         // Shared PrimResult type used by both single-node and multi-node (load_gltf_mesh) paths.
         struct PrimResult {
             Submesh submesh;
@@ -1460,6 +1481,7 @@ namespace Honey {
                 pr.submesh.material  = primData.material;
                 pr.submesh.name      = primData.name;
                 pr.submesh.transform = worldTransform;
+                pr.submesh.bounds    = compute_local_bounds(primData.vertices);
 
                 if (auto result = build_meshlet_geometry(primData.vertices, primData.indices)) {
                     pr.submesh.meshlets = result->geometry; // offsets will be filled in second pass
@@ -1608,6 +1630,7 @@ namespace Honey {
                 build.submesh.material = primData.material;
                 build.submesh.name = primData.name;
                 build.submesh.transform = worldTransform;
+                build.submesh.bounds = compute_local_bounds(primData.vertices);
 
                 if (auto result = build_meshlet_geometry(primData.vertices, primData.indices)) {
                     build.submesh.vertices = std::move(result->opt_vertices);
@@ -1751,6 +1774,7 @@ namespace Honey {
             resolve_slot_from_source(ext.pbr_specular_glossiness.diffuse_texture);
             resolve_slot_from_source(ext.pbr_specular_glossiness.specular_glossiness_texture);
 
+            mat->mark_dirty();
             return mat;
         }
 
@@ -1765,6 +1789,7 @@ namespace Honey {
                 submesh.material = finalize_material_payload(submeshPayload.material, textureCacheByImageIndex);
                 submesh.name = submeshPayload.name;
                 submesh.transform = submeshPayload.transform;
+                submesh.bounds = submeshPayload.bounds;
                 submesh.meshlets = submeshPayload.meshlets;
 
                 out->add_submesh(std::move(submesh));
@@ -1854,13 +1879,15 @@ namespace Honey {
             return current_index;
         }
 
-        static PendingSceneTreePayload build_pending_scene_tree_payload(
+        // Lays out the node hierarchy and lists the meshes to build; mesh_payloads is sized for
+        // them but left empty.
+        static void collect_pending_scene_nodes(
             const tinygltf::Model& model,
             const std::filesystem::path& path,
-            const GltfLoadOptions& options) {
+            PendingSceneTreePayload& out,
+            std::vector<PendingSceneMeshJob>& mesh_jobs) {
             HN_PROFILE_FUNCTION();
 
-            PendingSceneTreePayload out{};
             out.name = path.filename().stem().string();
 
             int scene_index = model.defaultScene;
@@ -1868,7 +1895,6 @@ namespace Honey {
                 scene_index = model.scenes.empty() ? -1 : 0;
             }
 
-            std::vector<PendingSceneMeshJob> mesh_jobs;
             if (scene_index >= 0) {
                 const tinygltf::Scene& scene = model.scenes[(size_t)scene_index];
                 out.roots.reserve(scene.nodes.size());
@@ -1891,31 +1917,6 @@ namespace Honey {
             }
 
             out.mesh_payloads.resize(mesh_jobs.size());
-            if (mesh_jobs.empty())
-                return out;
-
-            std::unordered_map<int, std::shared_ptr<DecodedImageRGBA8>> texturePayloadCacheByImageIndex;
-            std::mutex texturePayloadMutex;
-            const std::filesystem::path gltfDir = path.parent_path();
-
-            auto mesh_handle = TaskSystem::parallel_for(
-                0, static_cast<uint32_t>(mesh_jobs.size()),
-                [&](uint32_t i) {
-                    const auto& job = mesh_jobs[i];
-                    out.mesh_payloads[i] = build_pending_mesh_payload_for_gltf_mesh(
-                        model,
-                        job.gltf_mesh_index,
-                        glm::mat4(1.0f),
-                        gltfDir,
-                        options,
-                        texturePayloadCacheByImageIndex,
-                        &texturePayloadMutex,
-                        job.mesh_name
-                    );
-                }, 1);
-            TaskSystem::wait(mesh_handle);
-
-            return out;
         }
 
         static GltfNode finalize_pending_scene_node(
@@ -2146,15 +2147,34 @@ namespace Honey {
 
         auto handle = CreateRef<MeshAsyncHandle>();
 
-        TaskSystem::run_async([handle, path, options]() {
+        struct MeshLoad {
             tinygltf::Model model;
-            if (!parse_gltf_model(path, model)) {
+            bool parsed = false;
+        };
+        auto load = CreateRef<MeshLoad>();
+
+        // parse -> decode images, then hand the model to the upload/main thread.
+        auto graph = CreateRef<TaskGraph>();
+        graph->set_lane(TaskLane::background);
+        TaskGraph* g = graph.get();
+        const TaskGraph::Node decode = graph->add_for(0, [load](uint32_t i) {
+            decode_gltf_image(load->model.images[i]);
+        });
+        const TaskGraph::Node parse = graph->add([g, decode, load, path]() {
+            load->parsed = parse_gltf_document(path, load->model);
+            if (load->parsed)
+                g->set_count(decode, (uint32_t)load->model.images.size());
+        });
+        graph->precede(parse, decode);
+
+        graph->on_complete([handle, load, path, options]() {
+            if (!load->parsed) {
                 handle->failed.store(true, std::memory_order_release);
                 handle->done.store(true, std::memory_order_release);
                 return;
             }
 
-            auto finalize = [handle, path, options, model = std::move(model)]() mutable {
+            auto finalize = [handle, path, options, model = std::move(load->model)]() mutable {
                 Ref<Mesh> result = build_gltf_mesh_from_model(model, path, options, true);
                 if (!result)
                     handle->failed.store(true, std::memory_order_release);
@@ -2166,10 +2186,11 @@ namespace Honey {
             if (Renderer::get_api() == RendererAPI::API::vulkan) {
                 Application::get().get_vulkan_backend().enqueue_upload_job(std::move(finalize));
             } else {
-                TaskSystem::enqueue_main(std::move(finalize));
+                TaskSystem::enqueue_main(std::move(finalize), MainPriority::low);
             }
         });
 
+        TaskGraph::launch(std::move(graph));
         return handle;
     }
 
@@ -2177,18 +2198,62 @@ namespace Honey {
                                                               const GltfLoadOptions& options) {
         HN_PROFILE_FUNCTION();
         auto handle = CreateRef<GltfSceneTreeAsyncHandle>();
-        TaskSystem::run_async([handle, path, options]() {
+
+        struct SceneTreeLoad {
             tinygltf::Model model;
-            if (!parse_gltf_model(path, model)) {
+            bool parsed = false;
+            PendingSceneTreePayload pending;
+            std::vector<PendingSceneMeshJob> mesh_jobs;
+            std::unordered_map<int, std::shared_ptr<DecodedImageRGBA8>> texturePayloadCacheByImageIndex;
+            std::mutex texturePayloadMutex;
+        };
+        auto load = CreateRef<SceneTreeLoad>();
+
+        // parse -> decode images -> lay out nodes -> build meshes, then hand the payload to the
+        // upload/main thread. No stage waits on another from inside a worker.
+        auto graph = CreateRef<TaskGraph>();
+        graph->set_lane(TaskLane::background);
+        TaskGraph* g = graph.get();
+        const TaskGraph::Node decode = graph->add_for(0, [load](uint32_t i) {
+            decode_gltf_image(load->model.images[i]);
+        });
+        const TaskGraph::Node build_meshes = graph->add_for(0, [load, path, options](uint32_t i) {
+            const auto& job = load->mesh_jobs[i];
+            load->pending.mesh_payloads[i] = build_pending_mesh_payload_for_gltf_mesh(
+                load->model,
+                job.gltf_mesh_index,
+                glm::mat4(1.0f),
+                path.parent_path(),
+                options,
+                load->texturePayloadCacheByImageIndex,
+                &load->texturePayloadMutex,
+                job.mesh_name
+            );
+        });
+        const TaskGraph::Node parse = graph->add([g, decode, load, path]() {
+            load->parsed = parse_gltf_document(path, load->model);
+            if (load->parsed)
+                g->set_count(decode, (uint32_t)load->model.images.size());
+        });
+        const TaskGraph::Node collect = graph->add([g, build_meshes, load, path]() {
+            if (!load->parsed)
+                return;
+            collect_pending_scene_nodes(load->model, path, load->pending, load->mesh_jobs);
+            g->set_count(build_meshes, (uint32_t)load->mesh_jobs.size());
+        });
+        graph->precede(parse, decode);
+        graph->precede(decode, collect);
+        graph->precede(collect, build_meshes);
+
+        graph->on_complete([handle, load]() {
+            if (!load->parsed) {
                 handle->failed.store(true, std::memory_order_release);
                 handle->done.store(true, std::memory_order_release);
                 return;
             }
 
-            PendingSceneTreePayload pending = build_pending_scene_tree_payload(model, path, options);
-
-            auto finalize = [handle, pending = std::move(pending)]() mutable {
-                GltfSceneTree result = finalize_pending_scene_tree_payload(pending);
+            auto finalize = [handle, load]() {
+                GltfSceneTree result = finalize_pending_scene_tree_payload(load->pending);
                 if (result.roots.empty())
                     handle->failed.store(true, std::memory_order_release);
                 else
@@ -2199,9 +2264,11 @@ namespace Honey {
             if (Renderer::get_api() == RendererAPI::API::vulkan) {
                 Application::get().get_vulkan_backend().enqueue_upload_job(std::move(finalize));
             } else {
-                TaskSystem::enqueue_main(std::move(finalize));
+                TaskSystem::enqueue_main(std::move(finalize), MainPriority::low);
             }
         });
+
+        TaskGraph::launch(std::move(graph));
         return handle;
     }
 
@@ -66,4 +66,40 @@ namespace Honey::Math {
 
     }
 
+    AABB AABB::transformed(const glm::mat4& transform) const {
+        if (!is_valid())
+            return *this;
+
+        // Arvo: project the extents onto each world axis through |M|.
+        const glm::vec3 c = glm::vec3(transform * glm::vec4(center(), 1.0f));
+        const glm::vec3 e = extents();
+        glm::vec3 r;
+        for (int i = 0; i < 3; ++i)
+            r[i] = glm::abs(transform[0][i]) * e.x + glm::abs(transform[1][i]) * e.y + glm::abs(transform[2][i]) * e.z;
+
+        return { c - r, c + r };
+    }
+
+    Frustum Frustum::from_view_projection(const glm::mat4& m) {
+        // Gribb/Hartmann. glm is column-major, so row i is (m[0][i], m[1][i], m[2][i], m[3][i]).
+        // The near plane uses the -w <= z form, which is also conservative for [0, 1] depth.
+        auto row = [&](int i) { return glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]); };
+        const glm::vec4 r0 = row(0), r1 = row(1), r2 = row(2), r3 = row(3);
+
+        Frustum f;
+        f.planes[Left]   = r3 + r0;
+        f.planes[Right]  = r3 - r0;
+        f.planes[Bottom] = r3 + r1;
+        f.planes[Top]    = r3 - r1;
+        f.planes[Near]   = r3 + r2;
+        f.planes[Far]    = r3 - r2;
+
+        for (auto& p : f.planes) {
+            const float len = glm::length(glm::vec3(p));
+            if (len > 0.0f)
+                p /= len;
+        }
+        return f;
+    }
+
 }
@@ -2,8 +2,111 @@
 
 #include <glm/glm.hpp>
 
+#include <limits>
+
 namespace Honey::Math {
 
     bool decompose_transform(const glm::mat4& transform, glm::vec3& out_translation, glm::vec3& out_rotation, glm::vec3& out_scale);
 
-}
\ No newline at end of file
+    // Axis-aligned bounding box. Default-constructed boxes are empty (min > max)
+    // so they can be grown with expand() and tested with is_valid().
+    struct AABB {
+        glm::vec3 min{  std::numeric_limits<float>::max() };
+        glm::vec3 max{ -std::numeric_limits<float>::max() };
+
+        bool is_valid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+
+        glm::vec3 center()  const { return (min + max) * 0.5f; }
+        glm::vec3 extents() const { return (max - min) * 0.5f; }
+
+        void expand(const glm::vec3& point) {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+        void expand(const AABB& other) {
+            min = glm::min(min, other.min);
+            max = glm::max(max, other.max);
+        }
+
+        bool overlaps(const AABB& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+        bool contains(const AABB& other) const {
+            return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+                   max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+        }
+        bool overlaps_sphere(const glm::vec3& center, float radius) const {
+            const glm::vec3 d = glm::clamp(center, min, max) - center;
+            return glm::dot(d, d) <= radius * radius;
+        }
+        float surface_area() const {
+            const glm::vec3 d = max - min;
+            return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+        }
+
+        // Slab test. inv_dir is 1/direction per axis (inf for zero components is fine).
+        // On hit, t_enter is the entry distance clamped to 0 for rays starting inside.
+        bool intersects_ray(const glm::vec3& origin, const glm::vec3& inv_dir, float max_t, float& t_enter) const {
+            const glm::vec3 t0 = (min - origin) * inv_dir;
+            const glm::vec3 t1 = (max - origin) * inv_dir;
+            const glm::vec3 lo = glm::min(t0, t1);
+            const glm::vec3 hi = glm::max(t0, t1);
+            const float enter = glm::max(glm::max(lo.x, lo.y), glm::max(lo.z, 0.0f));
+            const float exit  = glm::min(glm::min(hi.x, hi.y), glm::min(hi.z, max_t));
+            if (enter > exit)
+                return false;
+            t_enter = enter;
+            return true;
+        }
+
+        // Bounds of this box after an affine transform (exact for the box, not just its corners' hull).
+        AABB transformed(const glm::mat4& transform) const;
+    };
+
+    // Six inward-facing planes (xyz = normal, w = distance) extracted from a view-projection matrix.
+    struct Frustum {
+        enum Plane { Left = 0, Right, Bottom, Top, Near, Far, Count };
+        glm::vec4 planes[Count]{};
+
+        static Frustum from_view_projection(const glm::mat4& view_proj);
+
+        // Conservative: may report boxes near frustum corners as visible.
+        bool intersects(const AABB& box) const {
+            const glm::vec3 c = box.center();
+            const glm::vec3 e = box.extents();
+            for (const auto& p : planes) {
+                const float r = e.x * glm::abs(p.x) + e.y * glm::abs(p.y) + e.z * glm::abs(p.z);
+                if (glm::dot(glm::vec3(p), c) + p.w < -r)
+                    return false;
+            }
+            return true;
+        }
+
+        bool intersects_sphere(const glm::vec3& center, float radius) const {
+            for (const auto& p : planes) {
+                if (glm::dot(glm::vec3(p), center) + p.w < -radius)
+                    return false;
+            }
+            return true;
+        }
+
+        // True if the box, swept infinitely along `direction`, touches the frustum.
+        // Used for shadow casters: direction is the light's travel direction.
+        bool intersects_swept(const AABB& box, const glm::vec3& direction) const {
+            const glm::vec3 c = box.center();
+            const glm::vec3 e = box.extents();
+            for (const auto& p : planes) {
+                // Moving along direction eventually crosses into this half-space.
+                if (glm::dot(glm::vec3(p), direction) > 0.0f)
+                    continue;
+                const float r = e.x * glm::abs(p.x) + e.y * glm::abs(p.y) + e.z * glm::abs(p.z);
+                if (glm::dot(glm::vec3(p), c) + p.w < -r)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+}
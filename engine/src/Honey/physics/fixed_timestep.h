@@ -0,0 +1,56 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace Honey {
+
+    // Accumulator for a fixed simulation rate. The simulation is kept up to one step ahead of
+    // real time: advance() banks the frame time and returns how many steps take the simulation
+    // past it, and alpha() is where real time falls between the last two simulated states, for
+    // blending render poses. Rendering therefore shows the present instead of lagging a step.
+    //
+    // A step may also be started before it is due (run_ahead), e.g. to overlap it with other
+    // work; the next advance() accounts for it.
+    class FixedTimestep {
+    public:
+        uint32_t advance(float frame_time, float step, uint32_t max_steps) {
+            m_step = step;
+            m_accumulator += frame_time;
+            if (m_accumulator < 0.0f)
+                return 0;
+
+            uint32_t steps = (uint32_t)(m_accumulator / step) + 1;
+            if (steps > max_steps) {
+                // Too far behind to catch up: keep the phase within a step, drop the rest.
+                m_dropped_steps += steps - max_steps;
+                steps = max_steps;
+                m_accumulator = std::fmod(m_accumulator, step) - step;
+            } else {
+                m_accumulator -= (float)steps * step;
+            }
+            return steps;
+        }
+
+        // Whether another frame as long as `frame_time` would make the next step due.
+        bool next_step_due(float frame_time) const { return m_accumulator + frame_time >= 0.0f; }
+        // Accounts for a step started before it was due.
+        void run_ahead() { m_accumulator -= m_step; }
+
+        float alpha() const { return m_step > 0.0f ? std::clamp(1.0f + m_accumulator / m_step, 0.0f, 1.0f) : 1.0f; }
+        float get_step() const { return m_step; }
+        uint64_t get_dropped_steps() const { return m_dropped_steps; }
+
+        void reset() {
+            m_accumulator = 0.0f;
+            m_dropped_steps = 0;
+        }
+
+    private:
+        float m_accumulator = 0.0f;
+        float m_step = 0.0f;
+        uint64_t m_dropped_steps = 0;
+    };
+
+}
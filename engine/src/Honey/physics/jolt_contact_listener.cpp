@@ -3,7 +3,7 @@
 
 #include "Honey/core/uuid.h"
 #include "Honey/scene/entity.h"
-#include "Honey/scripting/csharp_script_engine.h"
+#include "Honey/scene/scene.h"
 #include "Jolt/Physics/Body/Body.h"
 #include "Jolt/Physics/Body/BodyLock.h"
 #include "Jolt/Physics/PhysicsSystem.h"
@@ -20,21 +20,7 @@ namespace Honey {
 
     void JoltContactListener::OnContactAdded(const JPH::Body& bodyA, const JPH::Body& bodyB,
     const JPH::ContactManifold& manifold, JPH::ContactSettings& settings) {
-        UUID uuid_a = (uint64_t)bodyA.GetUserData();
-        UUID uuid_b = (uint64_t)bodyB.GetUserData();
-
-        Entity e_a = m_scene->get_entity(uuid_a);
-        Entity e_b = m_scene->get_entity(uuid_b);
-
-            if (!e_a.is_valid() || !e_b.is_valid()) return;
-
-        auto dispatch = [](Entity receiver, Entity other) {
-            if (receiver.has_component<ScriptComponent>())
-                CSharpScriptEngine::on_collision_begin(receiver, other);
-        };
-
-        dispatch(e_a, e_b);
-        dispatch(e_b, e_a);
+        record((uint64_t)bodyA.GetUserData(), (uint64_t)bodyB.GetUserData(), true);
     }
 
     void JoltContactListener::OnContactRemoved(const JPH::SubShapeIDPair& pair) {
@@ -43,20 +29,23 @@ namespace Honey {
 
         if (!lock_a.Succeeded() || !lock_b.Succeeded()) return;
 
-        UUID uuid_a = (uint64_t)lock_a.GetBody().GetUserData();
-        UUID uuid_b = (uint64_t)lock_b.GetBody().GetUserData();
+        record((uint64_t)lock_a.GetBody().GetUserData(), (uint64_t)lock_b.GetBody().GetUserData(), false);
+    }
 
-        Entity e_a = m_scene->get_entity(uuid_a);
-        Entity e_b = m_scene->get_entity(uuid_b);
+    void JoltContactListener::record(UUID a, UUID b, bool begin) {
+        std::lock_guard lock(m_events_mutex);
+        m_events.push_back({ a, b, begin });
+    }
 
-        if (!e_a.is_valid() || !e_b.is_valid()) return;
+    void JoltContactListener::dispatch_events() {
+        {
+            std::lock_guard lock(m_events_mutex);
+            m_dispatching.swap(m_events);
+        }
 
-        auto dispatch = [](Entity receiver, Entity other) {
-            if (receiver.has_component<ScriptComponent>())
-                CSharpScriptEngine::on_collision_end(receiver, other);
-        };
-        dispatch(e_a, e_b);
-        dispatch(e_b, e_a);
+        for (const auto& evt : m_dispatching)
+            m_scene->queue_collision(m_scene->get_entity(evt.a), m_scene->get_entity(evt.b), evt.begin);
+        m_dispatching.clear();
     }
 
 }
@@ -2,12 +2,19 @@
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 
+#include <mutex>
+#include <vector>
+#include "Honey/core/uuid.h"
+
 namespace JPH { class PhysicsSystem; }
 
 namespace Honey {
 
     class Scene;
 
+    // Jolt reports contacts from its worker threads while a step runs, possibly while the main
+    // thread is busy with scripts (see PhysicsEngine3D::step_async). The callbacks therefore only
+    // record the pair; dispatch_events hands them to scripts later, on the main thread.
     class JoltContactListener final : public JPH::ContactListener {
     public:
         explicit JoltContactListener(Scene* scene, JPH::PhysicsSystem* physics_system);
@@ -23,8 +30,24 @@ namespace Honey {
 
         void OnContactRemoved(const JPH::SubShapeIDPair& pair) override;
 
+        // Main thread only, with no step in flight. Hands the recorded pairs to
+        // Scene::queue_collision.
+        void dispatch_events();
+
     private:
+        struct ContactEvent {
+            UUID a;
+            UUID b;
+            bool begin;
+        };
+
+        void record(UUID a, UUID b, bool begin);
+
         Scene* m_scene;
         JPH::PhysicsSystem* m_physics_system;
+
+        std::mutex m_events_mutex;
+        std::vector<ContactEvent> m_events;
+        std::vector<ContactEvent> m_dispatching;
     };
 }
\ No newline at end of file
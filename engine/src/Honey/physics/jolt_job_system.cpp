@@ -2,11 +2,13 @@
 #include "jolt_job_system.h"
 
 #include "Honey/core/task_system.h"
+#include "Honey/core/timer.h"
 
 namespace Honey {
     JoltJobSystem::JoltJobSystem() {
         JobSystemWithBarrier::Init(cMaxBarriers); // Init barrier pool
         m_jobs.Init(cMaxJobs, cMaxJobs); // Init the job memory pool
+        m_tasks = std::make_unique<JoltTask[]>(cMaxTasksPerStep);
     }
 
     JoltJobSystem::~JoltJobSystem() {
@@ -17,13 +19,24 @@ namespace Honey {
         return (int)TaskSystem::raw().GetNumTaskThreads();
     }
 
+    void JoltJobSystem::begin_step() {
+        flush();
+
+        m_stats.jobs        = m_queued_jobs.exchange(0, std::memory_order_relaxed);
+        m_stats.inline_jobs = m_inline_jobs.exchange(0, std::memory_order_relaxed);
+        m_stats.waits       = m_waits;
+        m_stats.wait_ms     = m_wait_ms;
+        m_waits = 0;
+        m_wait_ms = 0.0f;
+    }
+
     void JoltJobSystem::flush() {
-        std::lock_guard lock(m_tasks_mutex);
-        for (auto* task : m_pending_tasks) {
-            TaskSystem::raw().WaitforTask(task);
-            delete task;
-        }
-        m_pending_tasks.clear();
+        // The jobs themselves are done once Update returns, but enkiTS may still be wrapping up a
+        // task that ran one; a task can only go back into the pipe once it is complete.
+        const uint32_t used = std::min(m_next_task.load(std::memory_order_acquire), cMaxTasksPerStep);
+        for (uint32_t i = 0; i < used; ++i)
+            TaskSystem::raw().WaitforTask(&m_tasks[i], enki::TASK_PRIORITY_HIGH);
+        m_next_task.store(0, std::memory_order_release);
     }
 
     JPH::JobHandle JoltJobSystem::CreateJob(const char* name, JPH::ColorArg color,
@@ -49,6 +62,14 @@ namespace Honey {
         return handle;
     }
 
+    void JoltJobSystem::WaitForJobs(JPH::JobSystem::Barrier* barrier) {
+        HN_PROFILE_FUNCTION();
+        Timer timer;
+        JobSystemWithBarrier::WaitForJobs(barrier);
+        m_wait_ms += timer.elapsed_millis();
+        m_waits++;
+    }
+
     void JoltJobSystem::FreeJob(JPH::JobSystem::Job* job) {
         m_jobs.DestructObject(job);
     }
@@ -57,21 +78,19 @@ namespace Honey {
         // Keep job alive while its in the enkiTS queue
         job->AddRef();
 
-        struct JoltTask final : enki::ITaskSet {
-            Job* m_job;
-            explicit JoltTask(Job* j) : enki::ITaskSet(1), m_job(j) {}
-            void ExecuteRange(enki::TaskSetPartition, uint32_t) override {
-                m_job->Execute(); // no-op if barrier already ran it
-                m_job->Release();
-            }
-        };
-
-        auto* task = new JoltTask(job);
-        {
-            std::lock_guard lock(m_tasks_mutex);
-            m_pending_tasks.push_back(task);
+        const uint32_t index = m_next_task.fetch_add(1, std::memory_order_relaxed);
+        if (index >= cMaxTasksPerStep) {
+            // Task pool spent for this step: run the job here rather than allocate a task.
+            m_inline_jobs.fetch_add(1, std::memory_order_relaxed);
+            job->Execute();
+            job->Release();
+            return;
         }
-        TaskSystem::raw().AddTaskSetToPipe(task);
+
+        m_queued_jobs.fetch_add(1, std::memory_order_relaxed);
+        JoltTask& task = m_tasks[index];
+        task.job = job;
+        TaskSystem::raw().AddTaskSetToPipe(&task);
     }
 
     void JoltJobSystem::QueueJobs(JPH::JobSystem::Job** jobs, uint32_t count) {
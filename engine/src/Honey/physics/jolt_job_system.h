@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/JobSystemWithBarrier.h>
 
@@ -9,30 +11,67 @@
 
 namespace Honey {
 
+    // Runs Jolt's jobs on the engine's enkiTS scheduler. Nothing is allocated per job: jobs come
+    // from a lock-free free list and each queued job borrows the next task from a fixed pool,
+    // which begin_step() recycles. Jobs queued once the pool is spent run on the queuing thread.
     class JoltJobSystem final : public JPH::JobSystemWithBarrier {
     public:
         static constexpr uint32_t cMaxJobs = 2048;
         static constexpr uint32_t cMaxBarriers = 64;
+        static constexpr uint32_t cMaxTasksPerStep = 4096;
+
+        // Per-step counters, for profiling.
+        struct Stats {
+            uint32_t jobs = 0;          // queued onto the task system
+            uint32_t inline_jobs = 0;   // run on the queuing thread because the task pool was spent
+            uint32_t waits = 0;
+            float    wait_ms = 0.0f;    // spent in WaitForJobs, i.e. the stepping thread blocked on workers
+        };
 
         JoltJobSystem();
         ~JoltJobSystem() override;
 
         int GetMaxConcurrency() const override;
 
+        // Call before each PhysicsSystem::Update, never during one: waits out the previous step's
+        // tasks, recycles the pool and publishes that step's counters.
+        void begin_step();
+        // Counters of the last step that begin_step() closed.
+        const Stats& get_stats() const { return m_stats; }
+
+        // Waits for every task queued since the last begin_step().
         void flush();
 
         JobHandle CreateJob(const char* name, JPH::ColorArg color,
             const JobFunction& fn, JPH::uint32 deps) override;
+        void WaitForJobs(JPH::JobSystem::Barrier* barrier) override;
     protected:
         void FreeJob(JPH::JobSystem::Job* job) override;
         void QueueJob(JPH::JobSystem::Job* job) override;
         void QueueJobs(JPH::JobSystem::Job** jobs, uint32_t count) override;
 
     private:
+        struct JoltTask final : enki::ITaskSet {
+            Job* job = nullptr;
+            // Queued ahead of everything else, like TaskLane::frame_critical work.
+            JoltTask() : enki::ITaskSet(1) { m_Priority = enki::TASK_PRIORITY_HIGH; }
+            void ExecuteRange(enki::TaskSetPartition, uint32_t) override {
+                job->Execute(); // no-op if barrier already ran it
+                job->Release();
+            }
+        };
+
         JPH::FixedSizeFreeList<Job> m_jobs;
 
-        std::mutex m_tasks_mutex;
-        std::vector<enki::ITaskSet*> m_pending_tasks;
+        std::unique_ptr<JoltTask[]> m_tasks;
+        std::atomic<uint32_t> m_next_task{0};
+
+        std::atomic<uint32_t> m_queued_jobs{0};
+        std::atomic<uint32_t> m_inline_jobs{0};
+        // Only the thread running the step waits on barriers.
+        uint32_t m_waits = 0;
+        float    m_wait_ms = 0.0f;
+        Stats    m_stats;
     };
 
 }
@@ -4,9 +4,9 @@
 #include "jolt_contact_listener.h"
 #include "jolt_job_system.h"
 #include "Honey/core/settings.h"
+#include "Honey/core/timer.h"
 #include "Jolt/RegisterTypes.h"
 #include "Jolt/Core/Factory.h"
-#include "Jolt/Physics/Body/BodyCreationSettings.h"
 #include "Jolt/Physics/Collision/Shape/BoxShape.h"
 #include "Jolt/Physics/Collision/Shape/CapsuleShape.h"
 #include "Jolt/Physics/Collision/Shape/SphereShape.h"
@@ -57,21 +57,54 @@ namespace Honey {
 
         m_contact_listener = std::make_unique<JoltContactListener>(scene, m_system.get());
         m_system->SetContactListener(m_contact_listener.get());
+        m_system->SetBodyActivationListener(&m_sleep_listener);
+        m_sleep_listener.fell_asleep.clear();
 
 #ifdef JPH_DEBUG_RENDERER
         if (!m_jolt_debug_renderer)
             m_jolt_debug_renderer = std::make_unique<JoltDebugRenderer>();
 #endif
 
-        // Create a body for every entity that already has a RigidbodyComponent
+        // Create a body for every entity that already has a RigidbodyComponent. Nothing else can
+        // touch the system yet, so the bodies skip the body locks and go in as one batch.
+        HN_PROFILE_SCOPE("PhysicsEngine3D::on_scene_start bodies");
+        Timer timer;
         auto view = scene->get_registry().view<RigidbodyComponent>();
-        for (auto e : view)
-            create_body(Entity{e, scene});
+        JPH::BodyInterface& bi = m_system->GetBodyInterfaceNoLock();
+        std::vector<JPH::BodyID> ids;
+        ids.reserve(view.size());
+
+        JPH::BodyCreationSettings bcs;
+        for (auto e : view) {
+            Entity entity{e, scene};
+            if (!make_body_settings(entity, bcs))
+                continue;
+
+            JPH::Body* body = bi.CreateBody(bcs);
+            if (!body) {
+                HN_CORE_WARN("PhysicsEngine3D: body pool exhausted ({0} bodies)", ids.size());
+                break;
+            }
+            bind_body(entity, *body);
+            ids.push_back(body->GetID());
+        }
+
+        if (!ids.empty()) {
+            JPH::BodyInterface::AddState state = bi.AddBodiesPrepare(ids.data(), (int)ids.size());
+            bi.AddBodiesFinalize(ids.data(), (int)ids.size(), state, JPH::EActivation::Activate);
+        }
+        // Bodies added in bulk land in an unbalanced tree; rebuild it before the first step.
+        m_system->OptimizeBroadPhase();
 
+        HN_CORE_INFO("PhysicsEngine3D: added {0} bodies ({1} unique shapes) in {2:.2f} ms",
+                     ids.size(), m_shapes.size(), timer.elapsed_millis());
     }
 
     void PhysicsEngine3D::on_scene_stop() {
+        join_step();
+        m_async_step_completed = false;
         m_system.reset();
+        m_shapes.clear();
         m_job_system.reset();
         m_temp_allocator.reset();
         m_scene = nullptr;
@@ -79,11 +112,94 @@ namespace Honey {
 
     void PhysicsEngine3D::step(float dt) {
         if (!m_system) return;
+        join_step();
+        m_job_system->begin_step();
         auto& settings = Settings::get().physics;
         m_system->Update(dt, settings.substeps, m_temp_allocator.get(), m_job_system.get());
     }
 
-    JPH::BodyID PhysicsEngine3D::create_body(Entity entity) {
+    void PhysicsEngine3D::step_async(float dt) {
+        if (!m_system) return;
+        join_step();
+        m_job_system->begin_step();
+
+        const int substeps = Settings::get().physics.substeps;
+        m_step_task = TaskSystem::run_async([this, dt, substeps]() {
+            HN_PROFILE_SCOPE("PhysicsEngine3D::step_async");
+            m_system->Update(dt, substeps, m_temp_allocator.get(), m_job_system.get());
+        }, TaskLane::frame_critical);
+
+        // No task system: the step still has to happen.
+        if (!m_step_task) {
+            m_system->Update(dt, substeps, m_temp_allocator.get(), m_job_system.get());
+            m_async_step_completed = true;
+        }
+    }
+
+    void PhysicsEngine3D::join_step() {
+        if (!m_step_task)
+            return;
+
+        HN_PROFILE_FUNCTION();
+        TaskSystem::wait(m_step_task);
+        m_step_task = {};
+        m_async_step_completed = true;
+
+        for (const auto& command : m_deferred_commands)
+            apply_command(command);
+        m_deferred_commands.clear();
+    }
+
+    bool PhysicsEngine3D::take_async_step() {
+        join_step();
+        const bool completed = m_async_step_completed;
+        m_async_step_completed = false;
+        return completed;
+    }
+
+    void PhysicsEngine3D::dispatch_contact_events() {
+        if (m_contact_listener)
+            m_contact_listener->dispatch_events();
+    }
+
+    void PhysicsEngine3D::apply_command(const BodyCommand& command) {
+        JPH::BodyInterface& bi = m_system->GetBodyInterface();
+        const JPH::Vec3 v(command.value.x, command.value.y, command.value.z);
+        switch (command.type) {
+        case BodyCommand::Type::AddForce:          bi.AddForce(command.id, v); break;
+        case BodyCommand::Type::AddImpulse:        bi.AddImpulse(command.id, v); break;
+        case BodyCommand::Type::SetLinearVelocity: bi.SetLinearVelocity(command.id, v); break;
+        case BodyCommand::Type::SetPose: {
+            const glm::quat& q = command.rotation;
+            bi.SetPositionAndRotation(command.id, JPH::RVec3(v), JPH::Quat(q.x, q.y, q.z, q.w),
+                                      JPH::EActivation::Activate);
+            break;
+        }
+        }
+    }
+
+    const JPH::Shape* PhysicsEngine3D::get_shape(const ShapeKey& key) {
+        auto [it, inserted] = m_shapes.try_emplace(key);
+        if (!inserted)
+            return it->second;
+
+        JPH::Shape::ShapeResult result;
+        switch (key.type) {
+        case ShapeKey::Type::Box:
+            result = JPH::BoxShapeSettings(JPH::Vec3(key.params.x, key.params.y, key.params.z)).Create();
+            break;
+        case ShapeKey::Type::Sphere:
+            result = JPH::SphereShapeSettings(key.params.x).Create();
+            break;
+        case ShapeKey::Type::Capsule:
+            result = JPH::CapsuleShapeSettings(key.params.x, key.params.y).Create();
+            break;
+        }
+        it->second = result.Get();
+        return it->second;
+    }
+
+    bool PhysicsEngine3D::make_body_settings(Entity entity, JPH::BodyCreationSettings& bcs) {
         auto& tc = entity.get_component<TransformComponent>();
         auto& rb = entity.get_component<RigidbodyComponent>();
 
@@ -103,39 +219,28 @@ namespace Honey {
             layer  = Layers::MOVING;
         }
 
-        JPH::Ref<JPH::Shape> shape;
+        ShapeKey key;
         float collider_friction    = 0.5f;
         float collider_restitution = 0.0f;
-        if (entity.has_component<BoxCollider3DComponent>()) {
-            auto& bc = entity.get_component<BoxCollider3DComponent>();
-            JPH::BoxShapeSettings settings(JPH::Vec3(
-                bc.half_size.x * tc.scale.x,
-                bc.half_size.y * tc.scale.y,
-                bc.half_size.z * tc.scale.z));
-            collider_friction    = bc.friction;
-            collider_restitution = bc.restitution;
-            shape = settings.Create().Get();
-        } else if (entity.has_component<SphereCollider3DComponent>()) {
-            auto& sc = entity.get_component<SphereCollider3DComponent>();
-            JPH::SphereShapeSettings settings(sc.radius * glm::max(tc.scale.x,
-                glm::max(tc.scale.y, tc.scale.z)));
-            collider_friction    = sc.friction;
-            collider_restitution = sc.restitution;
-            shape = settings.Create().Get();
-        } else if (entity.has_component<CapsuleCollider3DComponent>()) {
-            auto& cc = entity.get_component<CapsuleCollider3DComponent>();
-            JPH::CapsuleShapeSettings settings(cc.half_height, cc.radius);
-            collider_friction    = cc.friction;
-            collider_restitution = cc.restitution;
-            shape = settings.Create().Get();
+        if (auto* bc = entity.try_get_component<BoxCollider3DComponent>()) {
+            key = { ShapeKey::Type::Box, bc->half_size * tc.scale };
+            collider_friction    = bc->friction;
+            collider_restitution = bc->restitution;
+        } else if (auto* sc = entity.try_get_component<SphereCollider3DComponent>()) {
+            key = { ShapeKey::Type::Sphere, { sc->radius * glm::max(tc.scale.x, glm::max(tc.scale.y, tc.scale.z)), 0.0f, 0.0f } };
+            collider_friction    = sc->friction;
+            collider_restitution = sc->restitution;
+        } else if (auto* cc = entity.try_get_component<CapsuleCollider3DComponent>()) {
+            key = { ShapeKey::Type::Capsule, { cc->half_height, cc->radius, 0.0f } };
+            collider_friction    = cc->friction;
+            collider_restitution = cc->restitution;
         } else {
             // No collider - can't create a body
-            return JPH::BodyID();
+            return false;
         }
 
-        // Fill the body creation settings
-        JPH::BodyCreationSettings bcs(
-            shape,
+        bcs = JPH::BodyCreationSettings(
+            get_shape(key),
             JPH::RVec3(tc.translation.x, tc.translation.y, tc.translation.z),
             JPH::Quat::sEulerAngles(JPH::Vec3(tc.rotation.x, tc.rotation.y, tc.rotation.z)),
             motion,
@@ -150,23 +255,40 @@ namespace Honey {
         bcs.mIsSensor       = rb.is_sensor;
         if (!rb.gravity_factor) bcs.mGravityFactor = 0.0f;
 
+        // Store the entity UUID in the body's user data (same as b2Body_SetUserData)
+        bcs.mUserData = (JPH::uint64)entity.get_uuid();
+        return true;
+    }
+
+    void PhysicsEngine3D::bind_body(Entity entity, const JPH::Body& body) {
+        auto& tc = entity.get_component<TransformComponent>();
+        auto& rb = entity.get_component<RigidbodyComponent>();
+        rb.runtime_body_id = body.GetID().GetIndexAndSequenceNumber();
+        rb.previous_position = rb.current_position = tc.translation;
+        rb.previous_rotation = rb.current_rotation = glm::quat(tc.rotation);
+    }
+
+    JPH::BodyID PhysicsEngine3D::create_body(Entity entity) {
+        join_step();
+
+        JPH::BodyCreationSettings bcs;
+        if (!make_body_settings(entity, bcs))
+            return JPH::BodyID();
+
         // Create and add the body
         JPH::BodyInterface& bi = m_system->GetBodyInterface();
         JPH::Body* body = bi.CreateBody(bcs);
         if (!body) return JPH::BodyID(); // pool exhausted
 
-        // Store the entity UUID in the body's user data (same as b2Body_SetUserData)
-        body->SetUserData((JPH::uint64)entity.get_uuid());
-
-        // Activate it and store the ID back in the component
+        // Store the ID back in the component and activate it
+        bind_body(entity, *body);
         bi.AddBody(body->GetID(), JPH::EActivation::Activate);
-        rb.runtime_body_id = body->GetID().GetIndexAndSequenceNumber();
-
         return body->GetID();
     }
 
     void PhysicsEngine3D::destroy_body(JPH::BodyID id) {
         if (!m_system || id.IsInvalid()) return;
+        join_step();
         JPH::BodyInterface& bi = m_system->GetBodyInterface();
         bi.RemoveBody(id);
         bi.DestroyBody(id);
@@ -175,44 +297,84 @@ namespace Honey {
     void PhysicsEngine3D::sync_transform_to_body(Entity entity) {
         auto& rb = entity.get_component<RigidbodyComponent>();
         auto& tc = entity.get_component<TransformComponent>();
-        JPH::BodyID id{rb.runtime_body_id};
-        JPH::BodyInterface& bi = m_system->GetBodyInterface();
-        bi.SetPositionAndRotation(
-            id,
-            JPH::RVec3(tc.translation.x, tc.translation.y, tc.translation.z),
-            JPH::Quat::sEulerAngles(JPH::Vec3(tc.rotation.x, tc.rotation.y, tc.rotation.z)),
-            JPH::EActivation::Activate
-        );
+        rb.previous_position = rb.current_position = tc.translation;
+        rb.previous_rotation = rb.current_rotation = glm::quat(tc.rotation);
+
+        BodyCommand command{ BodyCommand::Type::SetPose, JPH::BodyID{rb.runtime_body_id}, tc.translation, rb.current_rotation };
+        if (is_step_in_flight())
+            m_deferred_commands.push_back(command);
+        else
+            apply_command(command);
     }
 
-    void PhysicsEngine3D::sync_body_to_transform(Entity entity) {
+    void PhysicsEngine3D::store_body_pose(Entity entity) {
         auto& rb = entity.get_component<RigidbodyComponent>();
-        auto& tc = entity.get_component<TransformComponent>();
         JPH::BodyID id{rb.runtime_body_id};
         JPH::BodyInterface& bi = m_system->GetBodyInterface();
 
         JPH::RVec3 pos = bi.GetPosition(id);
         JPH::Quat  rot = bi.GetRotation(id);
 
-        tc.translation = {pos.GetX(), pos.GetY(), pos.GetZ()};
+        rb.previous_position = rb.current_position;
+        rb.previous_rotation = rb.current_rotation;
+        rb.current_position = {pos.GetX(), pos.GetY(), pos.GetZ()};
+        rb.current_rotation = glm::quat(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
+
+        JPH::Vec3 vel = bi.GetLinearVelocity(id);
+        rb.current_linear_velocity = {vel.GetX(), vel.GetY(), vel.GetZ()};
+    }
+
+    void PhysicsEngine3D::collect_moved_bodies(std::vector<UUID>& out) {
+        out.clear();
+        if (!m_system) return;
+        join_step();
+
+        m_system->GetActiveBodies(JPH::EBodyType::RigidBody, m_active_bodies);
+        const JPH::BodyInterface& bi = m_system->GetBodyInterfaceNoLock();
+        for (const JPH::BodyID& id : m_active_bodies)
+            out.push_back((uint64_t)bi.GetUserData(id));
+
+        std::lock_guard lock(m_sleep_listener.mutex);
+        out.insert(out.end(), m_sleep_listener.fell_asleep.begin(), m_sleep_listener.fell_asleep.end());
+        m_sleep_listener.fell_asleep.clear();
+    }
+
+    void PhysicsEngine3D::sync_body_to_transform(Entity entity, float alpha) {
+        auto& rb = entity.get_component<RigidbodyComponent>();
+        auto& tc = entity.get_component<TransformComponent>();
 
-        // Convert quaternion -> euler (glm handles this)
-        glm::quat q(rot.GetW(), rot.GetX(), rot.GetY(), rot.GetZ());
-        tc.rotation = glm::eulerAngles(q);
-        tc.dirty = true;
+        tc.translation = glm::mix(rb.previous_position, rb.current_position, alpha);
+        tc.rotation = glm::eulerAngles(glm::slerp(rb.previous_rotation, rb.current_rotation, alpha));
+        entity.get_scene()->mark_transform_dirty(entity);
     }
 
     void PhysicsEngine3D::apply_force(JPH::BodyID id, glm::vec3 f) {
-        m_system->GetBodyInterface().AddForce(id, JPH::Vec3(f.x, f.y, f.z));
+        BodyCommand command{ BodyCommand::Type::AddForce, id, f, {} };
+        if (is_step_in_flight())
+            m_deferred_commands.push_back(command);
+        else
+            apply_command(command);
     }
     void PhysicsEngine3D::apply_impulse(JPH::BodyID id, glm::vec3 imp) {
-        m_system->GetBodyInterface().AddImpulse(id, JPH::Vec3(imp.x, imp.y, imp.z));
+        BodyCommand command{ BodyCommand::Type::AddImpulse, id, imp, {} };
+        if (is_step_in_flight())
+            m_deferred_commands.push_back(command);
+        else
+            apply_command(command);
     }
     void PhysicsEngine3D::set_velocity(JPH::BodyID id, glm::vec3 v) {
-        m_system->GetBodyInterface().SetLinearVelocity(id, JPH::Vec3(v.x, v.y, v.z));
+        BodyCommand command{ BodyCommand::Type::SetLinearVelocity, id, v, {} };
+        if (is_step_in_flight())
+            m_deferred_commands.push_back(command);
+        else
+            apply_command(command);
     }
-    glm::vec3 PhysicsEngine3D::get_velocity(JPH::BodyID id) const {
-        auto v = m_system->GetBodyInterface().GetLinearVelocity(id);
+    glm::vec3 PhysicsEngine3D::get_velocity(Entity entity) const {
+        auto& rb = entity.get_component<RigidbodyComponent>();
+        if (is_step_in_flight())
+            return rb.current_linear_velocity;
+
+        auto v = m_system->GetBodyInterface().GetLinearVelocity(JPH::BodyID{rb.runtime_body_id});
         return {v.GetX(), v.GetY(), v.GetZ()};
     }
 
@@ -226,11 +388,17 @@ namespace Honey {
         return m_system->GetNumActiveBodies(JPH::EBodyType::RigidBody);
     }
 
+    JoltJobSystem::Stats PhysicsEngine3D::get_job_stats() const {
+        if (!m_job_system) return {};
+        return m_job_system->get_stats();
+    }
+
     void PhysicsEngine3D::draw_debug()
     {
 #ifdef JPH_DEBUG_RENDERER
         if (!m_system || !m_jolt_debug_renderer)
             return;
+        join_step();
 
         JPH::BodyManager::DrawSettings draw_settings;
         draw_settings.mDrawShape              = true;
@@ -1,13 +1,19 @@
 #pragma once
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/PhysicsSystem.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
 #include <Jolt/Core/TempAllocator.h>
+#include <Jolt/Physics/Body/BodyActivationListener.h>
 
+#include <mutex>
+#include <unordered_map>
+
+#include "Honey/core/task_system.h"
+#include "Honey/physics/jolt_job_system.h"
 #include "Honey/scene/entity.h"
 
 namespace Honey {
     class Scene;
-    class JoltJobSystem;
     class JoltContactListener;
 #ifdef JPH_DEBUG_RENDERER
     class JoltDebugRenderer;
@@ -68,27 +74,53 @@ namespace Honey {
         static void init();    // called once at engine startup (registers Jolt allocators + types)
         static void shutdown();
 
-        // Per-scene lifetime
+        // Per-scene lifetime. Bodies for the scene's existing rigidbodies are added in one batch
+        // and the broad phase is rebuilt once, instead of body by body.
         void on_scene_start(Scene* scene);
         void on_scene_stop();
+        // The scene whose bodies the engine currently holds, or null between runs.
+        Scene* get_scene() const { return m_scene; }
 
-        // Called every game tick
+        // Runs one step on the calling thread.
         void step(float dt);
 
+        // Asynchronous stepping. step_async starts a step on the task system and returns at
+        // once; the step is finished by the next join_step, which every main-thread entry point
+        // below calls where needed. While a step is in flight:
+        //   - apply_force, apply_impulse, set_velocity and sync_transform_to_body are queued and
+        //     applied at the join, so they act on the step after the one in flight;
+        //   - get_velocity returns the velocity recorded by the last store_body_pose;
+        //   - create_body, destroy_body, draw_debug and on_scene_stop join first.
+        // Contacts from any step are buffered and reach scripts through dispatch_contact_events.
+        void step_async(float dt);
+        void join_step();
+        bool is_step_in_flight() const { return (bool)m_step_task; }
+        // Joins, then reports whether an asynchronous step completed since the last call.
+        bool take_async_step();
+        void dispatch_contact_events();
+
         // Body management
         JPH::BodyID create_body(Entity entity);
         void        destroy_body(JPH::BodyID id);
-        void        sync_transform_to_body(Entity entity);    // editor drag → physics
-        void        sync_body_to_transform(Entity entity);    // physics → ECS
+        void        sync_transform_to_body(Entity entity);    // editor drag → physics (a teleport: no blending)
+        // Shifts the component's current pose to previous and reads the body into current.
+        void        store_body_pose(Entity entity);
+        // physics → ECS: writes the pose `alpha` of the way from previous to current.
+        void        sync_body_to_transform(Entity entity, float alpha = 1.0f);
+        // UUIDs of the bodies that can have moved in the last step: the active ones plus those
+        // that fell asleep during it. Sleeping and static bodies are never listed.
+        void        collect_moved_bodies(std::vector<UUID>& out);
 
         // Impulse / force API (called from CSharpScriptGlue / ScriptGlue)
         void apply_force   (JPH::BodyID id, glm::vec3 force);
         void apply_impulse (JPH::BodyID id, glm::vec3 impulse);
         void set_velocity  (JPH::BodyID id, glm::vec3 v);
-        glm::vec3 get_velocity(JPH::BodyID id) const;
+        glm::vec3 get_velocity(Entity entity) const;
 
         uint32_t get_body_count() const;
         uint32_t get_active_body_count() const;
+        // Job counters of the last completed step.
+        JoltJobSystem::Stats get_job_stats() const;
 
         // Debug rendering — call between DebugRenderer3D::begin_scene() / end_scene().
         // No-op when JPH_DEBUG_RENDERER is not defined.
@@ -116,5 +148,59 @@ namespace Honey {
         OVOFilter               m_obj_vs_obj_filter;
 
         Scene* m_scene = nullptr;
+
+        struct BodyCommand {
+            enum class Type : uint8_t { AddForce, AddImpulse, SetLinearVelocity, SetPose };
+            Type        type;
+            JPH::BodyID id;
+            glm::vec3   value;
+            glm::quat   rotation; // SetPose only
+        };
+        void apply_command(const BodyCommand& command);
+
+        // Fills `settings` for the entity's body. Returns false when it has no collider.
+        bool make_body_settings(Entity entity, JPH::BodyCreationSettings& settings);
+        // Writes the new body's id and starting pose back to the component.
+        void bind_body(Entity entity, const JPH::Body& body);
+
+        // Colliders with identical (scaled) parameters share one shape for the scene's lifetime.
+        struct ShapeKey {
+            enum class Type : uint8_t { Box, Sphere, Capsule };
+            Type      type;
+            glm::vec3 params; // box half extents; sphere (radius); capsule (half height, radius)
+
+            bool operator==(const ShapeKey& other) const { return type == other.type && params == other.params; }
+        };
+        struct ShapeKeyHash {
+            size_t operator()(const ShapeKey& key) const {
+                size_t h = std::hash<float>{}(key.params.x);
+                h ^= std::hash<float>{}(key.params.y) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                h ^= std::hash<float>{}(key.params.z) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                h ^= (size_t)key.type + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                return h;
+            }
+        };
+        const JPH::Shape* get_shape(const ShapeKey& key);
+        std::unordered_map<ShapeKey, JPH::RefConst<JPH::Shape>, ShapeKeyHash> m_shapes;
+
+        // Bodies leave the active list in the step they fall asleep, which may still have moved
+        // them; this catches those. Called from Jolt's workers during a step.
+        class SleepListener final : public JPH::BodyActivationListener {
+        public:
+            void OnBodyActivated(const JPH::BodyID&, JPH::uint64) override {}
+            void OnBodyDeactivated(const JPH::BodyID&, JPH::uint64 user_data) override {
+                std::lock_guard lock(mutex);
+                fell_asleep.push_back(user_data);
+            }
+
+            std::mutex mutex;
+            std::vector<UUID> fell_asleep;
+        };
+        SleepListener m_sleep_listener;
+        JPH::BodyIDVector m_active_bodies;
+
+        TaskHandle m_step_task;
+        bool m_async_step_completed = false;
+        std::vector<BodyCommand> m_deferred_commands;
     };
 }
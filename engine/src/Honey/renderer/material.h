@@ -7,6 +7,8 @@
 
 namespace Honey {
 
+    namespace Renderer3DInternal { class GPUScene; }
+
     class Material {
     public:
         enum class AlphaMode : uint8_t {
@@ -137,58 +139,71 @@ namespace Honey {
         };
 
     public:
+        static constexpr uint32_t k_no_gpu_index = UINT32_MAX;
+
         Material() = default;
         ~Material() = default;
 
         static Ref<Material> create() { return CreateRef<Material>(); }
 
         const PBR& pbr() const { return m_pbr; }
+        // Direct access for bulk edits. Call mark_dirty() after editing through it; reading through
+        // it does not count as a change.
         PBR& pbr() { return m_pbr; }
 
-        void set_base_color_factor(const glm::vec4& factor) { m_pbr.base_color_factor = factor; }
+        // Bumped by every setter and by mark_dirty(); the renderer re-uploads the material when it
+        // changes.
+        uint32_t get_version() const { return m_version; }
+        void mark_dirty() { ++m_version; }
+
+        // Slot in the renderer's global material buffer, or k_no_gpu_index before first use.
+        uint32_t get_gpu_index() const { return m_gpu_index; }
+
+        void set_base_color_factor(const glm::vec4& factor) { m_pbr.base_color_factor = factor; mark_dirty(); }
         const glm::vec4& get_base_color_factor() const { return m_pbr.base_color_factor; }
 
-        void set_base_color_texture(const Ref<Texture2D>& texture) { m_pbr.base_color_texture.texture = texture; }
+        void set_base_color_texture(const Ref<Texture2D>& texture) { m_pbr.base_color_texture.texture = texture; mark_dirty(); }
         const Ref<Texture2D>& get_base_color_texture() const { return m_pbr.base_color_texture.texture; }
 
-        void set_metallic_factor(float factor) { m_pbr.metallic_factor = factor; }
+        void set_metallic_factor(float factor) { m_pbr.metallic_factor = factor; mark_dirty(); }
         float get_metallic_factor() const { return m_pbr.metallic_factor; }
 
-        void set_roughness_factor(float factor) { m_pbr.roughness_factor = factor; }
+        void set_roughness_factor(float factor) { m_pbr.roughness_factor = factor; mark_dirty(); }
         float get_roughness_factor() const { return m_pbr.roughness_factor; }
 
         void set_metallic_roughness_texture(const Ref<Texture2D>& texture) {
             m_pbr.metallic_roughness_texture.texture = texture;
+            mark_dirty();
         }
         const Ref<Texture2D>& get_metallic_roughness_texture() const {
             return m_pbr.metallic_roughness_texture.texture;
         }
 
-        void set_normal_texture(const Ref<Texture2D>& texture) { m_pbr.normal_texture.texture = texture; }
+        void set_normal_texture(const Ref<Texture2D>& texture) { m_pbr.normal_texture.texture = texture; mark_dirty(); }
         const Ref<Texture2D>& get_normal_texture() const { return m_pbr.normal_texture.texture; }
 
-        void set_normal_scale(float scale) { m_pbr.normal_scale = scale; }
+        void set_normal_scale(float scale) { m_pbr.normal_scale = scale; mark_dirty(); }
         float get_normal_scale() const { return m_pbr.normal_scale; }
 
-        void set_occlusion_texture(const Ref<Texture2D>& texture) { m_pbr.occlusion_texture.texture = texture; }
+        void set_occlusion_texture(const Ref<Texture2D>& texture) { m_pbr.occlusion_texture.texture = texture; mark_dirty(); }
         const Ref<Texture2D>& get_occlusion_texture() const { return m_pbr.occlusion_texture.texture; }
 
-        void set_occlusion_strength(float strength) { m_pbr.occlusion_strength = strength; }
+        void set_occlusion_strength(float strength) { m_pbr.occlusion_strength = strength; mark_dirty(); }
         float get_occlusion_strength() const { return m_pbr.occlusion_strength; }
 
-        void set_emissive_factor(const glm::vec3& factor) { m_pbr.emissive_factor = factor; }
+        void set_emissive_factor(const glm::vec3& factor) { m_pbr.emissive_factor = factor; mark_dirty(); }
         const glm::vec3& get_emissive_factor() const { return m_pbr.emissive_factor; }
 
-        void set_emissive_texture(const Ref<Texture2D>& texture) { m_pbr.emissive_texture.texture = texture; }
+        void set_emissive_texture(const Ref<Texture2D>& texture) { m_pbr.emissive_texture.texture = texture; mark_dirty(); }
         const Ref<Texture2D>& get_emissive_texture() const { return m_pbr.emissive_texture.texture; }
 
-        void set_alpha_mode(AlphaMode mode) { m_pbr.alpha_mode = mode; }
+        void set_alpha_mode(AlphaMode mode) { m_pbr.alpha_mode = mode; mark_dirty(); }
         AlphaMode get_alpha_mode() const { return m_pbr.alpha_mode; }
 
-        void set_alpha_cutoff(float cutoff) { m_pbr.alpha_cutoff = cutoff; }
+        void set_alpha_cutoff(float cutoff) { m_pbr.alpha_cutoff = cutoff; mark_dirty(); }
         float get_alpha_cutoff() const { return m_pbr.alpha_cutoff; }
 
-        void set_double_sided(bool value) { m_pbr.double_sided = value; }
+        void set_double_sided(bool value) { m_pbr.double_sided = value; mark_dirty(); }
         bool get_double_sided() const { return m_pbr.double_sided; }
 
         bool has_base_color_texture() const { return (bool)m_pbr.base_color_texture.texture; }
@@ -198,7 +213,11 @@ namespace Honey {
         bool has_emissive_texture() const { return (bool)m_pbr.emissive_texture.texture; }
 
     private:
+        friend class Renderer3DInternal::GPUScene;
+
         PBR m_pbr{};
+        uint32_t m_version = 0;
+        uint32_t m_gpu_index = k_no_gpu_index;
     };
 
 } // namespace Honey
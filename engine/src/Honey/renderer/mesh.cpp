@@ -12,6 +12,11 @@ namespace Honey {
     }
 
     void Mesh::add_submesh(Submesh submesh) {
+        if (submesh.bounds.is_valid() && (m_submeshes.empty() || m_bounds.is_valid()))
+            m_bounds.expand(submesh.bounds.transformed(submesh.transform));
+        else
+            m_bounds = {}; // one unbounded submesh makes the whole mesh unbounded
+
         m_submeshes.push_back(std::move(submesh));
     }
 
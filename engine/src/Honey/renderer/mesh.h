@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Honey/core/base.h"
+#include "Honey/math/math.h"
 #include "material.h"
 
 #include <string>
@@ -75,6 +76,10 @@ namespace Honey {
         std::string name;
 
         glm::mat4 transform = glm::mat4(1.0f);
+
+        // Vertex-space bounds (before `transform`), computed at import. Used for CPU
+        // frustum culling; an invalid box means "unknown" and is never culled.
+        Math::AABB bounds;
     };
 
     class Mesh {
@@ -93,6 +98,10 @@ namespace Honey {
 
         void add_submesh(Submesh submesh);
 
+        // Mesh-space bounds of all submeshes (submesh transforms applied). Invalid if any
+        // submesh has no bounds. Maintained by add_submesh.
+        const Math::AABB& get_bounds() const { return m_bounds; }
+
         bool empty() const { return m_submeshes.empty(); }
         size_t submesh_count() const { return m_submeshes.size(); }
 
@@ -103,6 +112,7 @@ namespace Honey {
     private:
         std::string m_name;
         std::vector<Submesh> m_submeshes;
+        Math::AABB m_bounds;
     };
 
 }
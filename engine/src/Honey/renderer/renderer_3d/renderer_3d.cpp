@@ -201,6 +201,23 @@ namespace Honey {
             });
     }
 
+    void Renderer3D::submit_draw_commands(const MeshletDrawCommand* commands, size_t count) {
+        HN_PROFILE_FUNCTION();
+        if (!commands || count == 0)
+            return;
+
+        auto& draws = Renderer3DInternal::g_renderer3d_data->meshlet_draws;
+        draws.insert(draws.end(), commands, commands + count);
+    }
+
+    void Renderer3D::record_culled_submissions(uint32_t count) {
+        Renderer3DInternal::g_renderer3d_data->stats.culled_submissions += count;
+    }
+
+    void Renderer3D::record_culled_instances(uint32_t count) {
+        Renderer3DInternal::g_renderer3d_data->stats.culled_instances += count;
+    }
+
     void Renderer3D::submit_icon(const Ref<VectorIcon>& icon, const glm::vec3& world_pos, float size,
         SizeMode sizemode, const glm::vec4& tint, int entity_id) {
         HN_PROFILE_FUNCTION();
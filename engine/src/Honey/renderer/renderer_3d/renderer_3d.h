@@ -24,18 +24,33 @@ namespace Honey {
         struct Statistics {
             uint32_t draw_calls = 0;
             uint32_t mesh_submissions = 0;
+            uint32_t culled_instances = 0;   // mesh entities rejected by the CPU spatial query
+            uint32_t culled_submissions = 0; // submeshes of visible entities rejected individually
             uint32_t unique_meshes = 0;
             uint64_t vertex_count = 0;
             uint64_t index_count = 0;
             uint64_t triangle_count = 0;
             uint32_t pipeline_binds = 0;
             uint32_t push_constant_updates = 0;
+            uint32_t instances_patched = 0;  // draw-data entries rewritten; unchanged instances are skipped
+            uint32_t materials_patched = 0;
+            uint64_t bytes_uploaded = 0;     // draw data, indirect args and material patches written this frame
         };
 		enum class SizeMode {
 			ScreenSpace,
 			WorldSpace
 		};
 
+		// One submesh draw as queued by submit_submesh. Public so callers can build
+		// draw lists off the main thread and hand them over with submit_draw_commands.
+		struct MeshletDrawCommand {
+			const Submesh* submesh = nullptr;
+			const Mesh* mesh = nullptr;
+			Material* material = nullptr;
+			glm::mat4 transform{1.0f};
+			int entity_id = -1;
+		};
+
 		static void init();
 		static void shutdown();
 
@@ -56,6 +71,11 @@ namespace Honey {
 
 		// Generic mesh rendering
 		static void submit_submesh(const Submesh& submesh, const Ref<Material>& material, const glm::mat4& transform, int entity_id = -1, const Mesh* mesh = nullptr);
+		// Appends pre-built commands in order. Main thread only, between begin_scene/end_scene.
+		static void submit_draw_commands(const MeshletDrawCommand* commands, size_t count);
+		// Stats only: submeshes the caller skipped after a CPU visibility test.
+		static void record_culled_submissions(uint32_t count);
+		static void record_culled_instances(uint32_t count);
 		static void submit_icon(const Ref<VectorIcon>& icon, const glm::vec3& world_pos, float size,
 			SizeMode sizemode, const glm::vec4& tint = glm::vec4(1.0f), int entity_id = -1);
 
@@ -14,18 +14,22 @@ namespace Honey::Renderer3DInternal {
             return glm::vec4(slot.transform.scale.x, slot.transform.scale.y, slot.transform.offset.x, slot.transform.offset.y);
         }
 
-        int32_t register_material_texture(Texture2D* tex) {
+        // Renderer3D is Vulkan-only (see end_scene), so every Texture2D here is a VulkanTexture2D.
+        int32_t register_material_texture(Texture2D* tex, bool* out_pending) {
             if (!tex) return -1;
-            auto* vk = dynamic_cast<VulkanTexture2D*>(tex);
-            if (!vk) return -1;
-            return (int32_t)vk->get_bindless_index();
+            const uint32_t index = static_cast<VulkanTexture2D*>(tex)->get_bindless_index();
+            if (index == UINT32_MAX) {
+                if (out_pending) *out_pending = true;
+                return -1;
+            }
+            return (int32_t)index;
         }
     }
 
-    GPUMaterial build_gpu_material(const Material* mat) {
+    GPUMaterial build_gpu_material(const Material* mat, bool* out_textures_pending) {
         GPUMaterial gpu{};
         if (!mat) {
-            gpu.base_color_tex_id = register_material_texture(g_renderer3d_data->white_texture.get());
+            gpu.base_color_tex_id = register_material_texture(g_renderer3d_data->white_texture.get(), out_textures_pending);
             return gpu;
         }
 
@@ -42,11 +46,11 @@ namespace Honey::Renderer3DInternal {
         gpu.unlit = pbr.extensions.unlit.enabled ? 1 : 0;
 
         Texture2D* base_tex = pbr.base_color_texture.texture ? pbr.base_color_texture.texture.get() : g_renderer3d_data->white_texture.get();
-        gpu.base_color_tex_id = register_material_texture(base_tex);
-        gpu.metallic_roughness_tex_id = register_material_texture(pbr.metallic_roughness_texture.texture.get());
-        gpu.normal_tex_id = register_material_texture(pbr.normal_texture.texture.get());
-        gpu.occlusion_tex_id = register_material_texture(pbr.occlusion_texture.texture.get());
-        gpu.emissive_tex_id = register_material_texture(pbr.emissive_texture.texture.get());
+        gpu.base_color_tex_id = register_material_texture(base_tex, out_textures_pending);
+        gpu.metallic_roughness_tex_id = register_material_texture(pbr.metallic_roughness_texture.texture.get(), out_textures_pending);
+        gpu.normal_tex_id = register_material_texture(pbr.normal_texture.texture.get(), out_textures_pending);
+        gpu.occlusion_tex_id = register_material_texture(pbr.occlusion_texture.texture.get(), out_textures_pending);
+        gpu.emissive_tex_id = register_material_texture(pbr.emissive_texture.texture.get(), out_textures_pending);
 
         gpu.base_color_uv_set = pbr.base_color_texture.tex_coord;
         gpu.metallic_roughness_uv_set = pbr.metallic_roughness_texture.tex_coord;
@@ -0,0 +1,237 @@
+#include "hnpch.h"
+#include "renderer_3d_gpu_scene.h"
+#include "renderer_3d_internal.h"
+
+#include "platform/vulkan/vk_renderer_api.h"
+
+namespace Honey::Renderer3DInternal {
+
+    namespace {
+        // Calls write_run(first, count) for every maximal run of positions in [base, base + count)
+        // whose stamp differs from version_of(i), updating the stamps as it goes.
+        template<typename VersionFn, typename WriteRunFn>
+        void for_each_stale_run(std::vector<uint32_t>& stamps, uint32_t base, uint32_t count,
+                                VersionFn&& version_of, WriteRunFn&& write_run) {
+            if (stamps.size() < base + count)
+                stamps.resize(base + count, 0);
+
+            uint32_t i = 0;
+            while (i < count) {
+                if (stamps[base + i] == version_of(i)) {
+                    ++i;
+                    continue;
+                }
+                const uint32_t first = i;
+                while (i < count && stamps[base + i] != version_of(i)) {
+                    stamps[base + i] = version_of(i);
+                    ++i;
+                }
+                write_run(first, i - first);
+            }
+        }
+    }
+
+    void GPUScene::begin_flush() {
+        ++m_flush;
+        m_transient.clear();
+        if (m_flush % k_sweep_interval == 0)
+            sweep();
+    }
+
+    uint32_t GPUScene::acquire_material(Material* material) {
+        if (!material)
+            material = g_renderer3d_data->default_material.get();
+
+        // The index on the material is only a hint: a slot retired while the material sat idle may
+        // since have been handed to another one, and a copied material carries its source's index.
+        uint32_t index = material->m_gpu_index;
+        if (index >= (uint32_t)m_materials.size() || m_materials[index].material != material) {
+            if (!m_free_materials.empty()) {
+                index = m_free_materials.back();
+                m_free_materials.pop_back();
+            } else {
+                index = (uint32_t)m_materials.size();
+                m_materials.emplace_back();
+            }
+            HN_CORE_ASSERT(index < VulkanRendererGlobals::k_max_material_count,
+                           "GPUScene: material slot {0} exceeds the materials buffer capacity", index);
+            m_materials[index] = MaterialSlot{ material };
+            material->m_gpu_index = index;
+            m_materials[index].queued = true;
+            m_dirty_materials.push_back(index);
+        }
+
+        MaterialSlot& slot = m_materials[index];
+        slot.last_used = m_flush;
+        if (!slot.queued && (slot.uploaded_version != material->get_version() || slot.textures_pending)) {
+            slot.queued = true;
+            m_dirty_materials.push_back(index);
+        }
+        return index;
+    }
+
+    void GPUScene::flush_materials(UploadStats& stats) {
+        HN_PROFILE_FUNCTION();
+
+        for (uint32_t index : m_dirty_materials) {
+            MaterialSlot& slot = m_materials[index];
+            bool textures_pending = false;
+            const GPUMaterial gpu = build_gpu_material(slot.material, &textures_pending);
+            VulkanRendererAPI::write_material(index, gpu);
+
+            slot.uploaded_version = slot.material->get_version();
+            slot.textures_pending = textures_pending;
+            slot.queued = false;
+            stats.materials_patched++;
+            stats.bytes_uploaded += sizeof(GPUMaterial);
+        }
+        m_dirty_materials.clear();
+    }
+
+    uint32_t GPUScene::acquire_instance(const DrawCommand& cmd, uint32_t material_slot) {
+        const auto& geo = cmd.submesh->meshlets;
+
+        if (cmd.entity_id < 0) {
+            Instance& inst = m_transient.emplace_back();
+            inst.transform       = cmd.transform;
+            inst.submesh         = cmd.submesh;
+            inst.entity_id       = cmd.entity_id;
+            inst.meshlets_offset = geo.meshlets_offset;
+            inst.meshlet_count   = geo.meshlet_count;
+            inst.material_slot   = material_slot;
+            inst.version         = ++m_version_clock;
+            inst.last_used       = m_flush;
+            return k_transient_bit | (uint32_t)(m_transient.size() - 1);
+        }
+
+        auto [it, inserted] = m_instance_lookup.try_emplace(InstanceKey{ cmd.entity_id, cmd.submesh }, k_invalid_slot);
+        if (inserted) {
+            if (!m_free_instances.empty()) {
+                it->second = m_free_instances.back();
+                m_free_instances.pop_back();
+            } else {
+                it->second = (uint32_t)m_instances.size();
+                m_instances.emplace_back();
+            }
+            HN_CORE_ASSERT(it->second < k_transient_bit, "GPUScene: instance slots exhausted");
+        }
+
+        Instance& inst = m_instances[it->second];
+        const bool changed = inserted ||
+            inst.material_slot != material_slot ||
+            inst.meshlets_offset != geo.meshlets_offset ||
+            inst.meshlet_count != geo.meshlet_count ||
+            std::memcmp(&inst.transform, &cmd.transform, sizeof(glm::mat4)) != 0;
+
+        if (changed) {
+            inst.transform       = cmd.transform;
+            inst.submesh         = cmd.submesh;
+            inst.entity_id       = cmd.entity_id;
+            inst.meshlets_offset = geo.meshlets_offset;
+            inst.meshlet_count   = geo.meshlet_count;
+            inst.material_slot   = material_slot;
+            inst.version         = ++m_version_clock;
+        }
+        inst.last_used = m_flush;
+        return it->second;
+    }
+
+    void GPUScene::upload_draw_data(const Mesh* mesh, StorageBuffer& buffer, uint32_t ring_slot, bool fresh,
+                                    uint32_t base, const uint32_t* instance_ids, uint32_t count, UploadStats& stats) {
+        HN_PROFILE_FUNCTION();
+
+        auto& stamps = m_draw_data_stamps[mesh][ring_slot];
+        if (fresh)
+            stamps.versions.clear();
+        stamps.last_used = m_flush;
+
+        auto version_of = [&](uint32_t i) { return get_instance(instance_ids[i]).version; };
+        for_each_stale_run(stamps.versions, base, count, version_of, [&](uint32_t first, uint32_t run) {
+            m_scratch_draw_data.clear();
+            for (uint32_t i = first; i < first + run; ++i) {
+                const Instance& inst = get_instance(instance_ids[i]);
+                m_scratch_draw_data.push_back({
+                    inst.transform,
+                    inst.meshlets_offset,
+                    inst.meshlet_count,
+                    (int32_t)inst.material_slot,
+                    inst.entity_id,
+                });
+            }
+
+            const uint32_t bytes = run * (uint32_t)sizeof(GPUDrawData);
+            buffer.set_data(m_scratch_draw_data.data(), bytes, (base + first) * (uint32_t)sizeof(GPUDrawData));
+            stats.instances_patched += run;
+            stats.bytes_uploaded += bytes;
+        });
+    }
+
+    void GPUScene::upload_indirect(StorageBuffer& buffer, uint32_t frame_slot, bool fresh,
+                                   uint32_t base, const uint32_t* instance_ids, uint32_t count, UploadStats& stats) {
+        auto& stamps = m_indirect_stamps[frame_slot];
+        if (fresh)
+            stamps.versions.clear();
+
+        auto version_of = [&](uint32_t i) { return get_instance(instance_ids[i]).version; };
+        for_each_stale_run(stamps.versions, base, count, version_of, [&](uint32_t first, uint32_t run) {
+            m_scratch_indirect.clear();
+            for (uint32_t i = first; i < first + run; ++i)
+                m_scratch_indirect.push_back({ get_instance(instance_ids[i]).meshlet_count, 1, 1 });
+
+            const uint32_t bytes = run * (uint32_t)sizeof(VkDrawMeshTasksIndirectCommandEXT);
+            buffer.set_data(m_scratch_indirect.data(), bytes, (base + first) * (uint32_t)sizeof(VkDrawMeshTasksIndirectCommandEXT));
+            stats.bytes_uploaded += bytes;
+        });
+    }
+
+    void GPUScene::upload_count(StorageBuffer& buffer, uint32_t frame_slot, bool fresh,
+                                uint32_t index, uint32_t count, UploadStats& stats) {
+        auto& stamps = m_count_stamps[frame_slot];
+        if (fresh)
+            stamps.versions.clear();
+
+        // Stamps hold count + 1 so that 0 keeps meaning "unknown".
+        if (stamps.versions.size() <= index)
+            stamps.versions.resize(index + 1, 0);
+        if (stamps.versions[index] == count + 1)
+            return;
+
+        stamps.versions[index] = count + 1;
+        buffer.set_data(&count, sizeof(uint32_t), index * (uint32_t)sizeof(uint32_t));
+        stats.bytes_uploaded += sizeof(uint32_t);
+    }
+
+    void GPUScene::sweep() {
+        HN_PROFILE_FUNCTION();
+
+        for (uint32_t i = 0; i < (uint32_t)m_instances.size(); ++i) {
+            Instance& inst = m_instances[i];
+            if (!inst.submesh || m_flush - inst.last_used < k_retire_after_flushes)
+                continue;
+            m_instance_lookup.erase(InstanceKey{ inst.entity_id, inst.submesh });
+            inst = Instance{};
+            m_free_instances.push_back(i);
+        }
+
+        for (uint32_t i = 0; i < (uint32_t)m_materials.size(); ++i) {
+            MaterialSlot& slot = m_materials[i];
+            if (!slot.material || m_flush - slot.last_used < k_retire_after_flushes)
+                continue;
+            slot = MaterialSlot{};
+            m_free_materials.push_back(i);
+        }
+
+        // Mesh pointers here are only ever used as keys, and a new mesh at a recycled address
+        // arrives with freshly created draw-data buffers, so stale entries just age out.
+        for (auto it = m_draw_data_stamps.begin(); it != m_draw_data_stamps.end();) {
+            uint32_t last_used = 0;
+            for (const auto& stamps : it->second)
+                last_used = std::max(last_used, stamps.last_used);
+            if (m_flush - last_used >= k_retire_after_flushes)
+                it = m_draw_data_stamps.erase(it);
+            else
+                ++it;
+        }
+    }
+
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+#include "Honey/core/base.h"
+#include "Honey/renderer/buffer.h"
+#include "Honey/renderer/gpu_types.h"
+#include "Honey/renderer/material.h"
+#include "Honey/renderer/mesh.h"
+#include "Honey/renderer/renderer_3d/renderer_3d.h"
+#include "platform/vulkan/vk_context.h"
+
+namespace Honey::Renderer3DInternal {
+
+    // Retained GPU-side view of the meshlet draw list. Instances ((entity, submesh) pairs) and
+    // materials get slots that survive across frames. A material remembers its slot itself and
+    // carries its own version counter; it is rebuilt only when that version moves. Every change to
+    // an instance takes a fresh version from a single monotonic clock. Each GPU buffer position remembers the version
+    // it was last written with, so re-submitting an unchanged draw at the same position costs a
+    // 4-byte compare instead of a GPUDrawData upload. Because versions are never reused, a freed
+    // and recycled slot can never alias a stale buffer entry.
+    //
+    // Draws without an entity id (editor helpers, previews) are transient: they get a fresh
+    // version every flush and are always uploaded.
+    class GPUScene {
+    public:
+        using DrawCommand = Renderer3D::MeshletDrawCommand;
+
+        static constexpr uint32_t k_invalid_slot = UINT32_MAX;
+        // Slots not referenced for this many flushes are returned to the free lists.
+        static constexpr uint32_t k_retire_after_flushes = 240;
+
+        struct Instance {
+            glm::mat4 transform{1.0f};
+            const Submesh* submesh = nullptr;
+            int entity_id = -1;
+            uint32_t meshlets_offset = 0;
+            uint32_t meshlet_count = 0;
+            uint32_t material_slot = k_invalid_slot;
+            uint32_t version = 0;
+            uint32_t last_used = 0;
+        };
+
+        struct UploadStats {
+            uint32_t instances_patched = 0;
+            uint32_t materials_patched = 0;
+            uint64_t bytes_uploaded = 0;
+        };
+
+        // Starts a flush: advances the retirement clock and periodically sweeps unused slots.
+        void begin_flush();
+
+        // Persistent index into the global materials buffer. Queues the material for upload when
+        // it is new or its version moved since the last upload; a null material maps to the
+        // renderer's default material.
+        uint32_t acquire_material(Material* material);
+        // Rebuilds and writes every queued material. Call once per flush, after all acquires.
+        void flush_materials(UploadStats& stats);
+        // Returns an instance id for this draw, bumping its version if the transform or material changed.
+        uint32_t acquire_instance(const DrawCommand& cmd, uint32_t material_slot);
+
+        const Instance& get_instance(uint32_t id) const {
+            return (id & k_transient_bit) ? m_transient[id & ~k_transient_bit] : m_instances[id];
+        }
+
+        // Writes draw data for `count` instances at [base, base + count) of the mesh's per-frame
+        // draw-data buffer, skipping positions that already hold the same instance version.
+        // `fresh` must be set when the buffer was (re)created this flush: its contents are unknown.
+        void upload_draw_data(const Mesh* mesh, StorageBuffer& buffer, uint32_t ring_slot, bool fresh,
+                              uint32_t base, const uint32_t* instance_ids, uint32_t count, UploadStats& stats);
+        // Same for the frame's indirect-argument buffer (one 12-byte command per draw).
+        void upload_indirect(StorageBuffer& buffer, uint32_t frame_slot, bool fresh,
+                             uint32_t base, const uint32_t* instance_ids, uint32_t count, UploadStats& stats);
+        // Per-dispatch draw counts; tiny, but unchanged most frames.
+        void upload_count(StorageBuffer& buffer, uint32_t frame_slot, bool fresh,
+                          uint32_t index, uint32_t count, UploadStats& stats);
+
+        uint32_t get_instance_count() const { return (uint32_t)(m_instances.size() - m_free_instances.size()); }
+        uint32_t get_material_count() const { return (uint32_t)(m_materials.size() - m_free_materials.size()); }
+
+    private:
+        static constexpr uint32_t k_transient_bit = 0x80000000u;
+        static constexpr uint32_t k_sweep_interval = 64;
+
+        struct InstanceKey {
+            int entity_id;
+            const Submesh* submesh;
+
+            bool operator==(const InstanceKey& other) const {
+                return entity_id == other.entity_id && submesh == other.submesh;
+            }
+        };
+
+        struct InstanceKeyHash {
+            size_t operator()(const InstanceKey& key) const {
+                size_t h = std::hash<const void*>{}(key.submesh);
+                h ^= (size_t)(uint32_t)key.entity_id + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+                return h;
+            }
+        };
+
+        struct MaterialSlot {
+            const Material* material = nullptr; // owner; never dereferenced outside a flush that uses it
+            uint32_t uploaded_version = 0;
+            uint32_t last_used = 0;
+            bool queued = false;
+            // A texture had no bindless index yet (async load in flight); rebuild until it does.
+            bool textures_pending = false;
+        };
+
+        // What a GPU buffer currently holds, by position; 0 means unknown.
+        struct BufferStamps {
+            std::vector<uint32_t> versions;
+            uint32_t last_used = 0;
+        };
+
+        void sweep();
+
+        uint32_t m_flush = 0;
+        uint32_t m_version_clock = 0;
+
+        std::vector<Instance> m_instances;
+        std::vector<uint32_t> m_free_instances;
+        std::unordered_map<InstanceKey, uint32_t, InstanceKeyHash> m_instance_lookup;
+        std::vector<Instance> m_transient;
+
+        std::vector<MaterialSlot> m_materials;
+        std::vector<uint32_t> m_free_materials;
+        std::vector<uint32_t> m_dirty_materials;
+
+        std::unordered_map<const Mesh*, std::array<BufferStamps, GlobalMeshletBuffers::k_frame_ring_size>> m_draw_data_stamps;
+        std::array<BufferStamps, VulkanContext::k_max_frames_in_flight> m_indirect_stamps{};
+        std::array<BufferStamps, VulkanContext::k_max_frames_in_flight> m_count_stamps{};
+
+        std::vector<GPUDrawData> m_scratch_draw_data;
+        std::vector<VkDrawMeshTasksIndirectCommandEXT> m_scratch_indirect;
+    };
+
+}
@@ -14,6 +14,7 @@
 #include "Honey/renderer/mesh.h"
 #include "Honey/renderer/pipeline.h"
 #include "Honey/renderer/renderer_3d/renderer_3d.h"
+#include "Honey/renderer/renderer_3d/renderer_3d_gpu_scene.h"
 #include "Honey/renderer/shader_cache.h"
 #include "Honey/renderer/vector_icon.h"
 #include "platform/vulkan/vk_context.h"
@@ -42,13 +43,7 @@ namespace Honey::Renderer3DInternal {
         }
     };
 
-    struct MeshletDrawCommand {
-        const Submesh* submesh = nullptr;
-        const Mesh* mesh = nullptr;
-        Material* material = nullptr;
-        glm::mat4 transform{1.0f};
-        int entity_id = -1;
-    };
+    using MeshletDrawCommand = Renderer3D::MeshletDrawCommand;
 
     struct IconDrawCommand {
         const Ref<VectorIcon> icon;
@@ -76,11 +71,12 @@ namespace Honey::Renderer3DInternal {
         std::vector<IconDrawCommand> icon_draws;
         std::array<Ref<StorageBuffer>, VulkanContext::k_max_frames_in_flight> icon_instance_buffers{};
 
-        std::vector<GPUMaterial> frame_gpu_materials;
+        // Persistent instance/material slots behind meshlet_draws; see renderer_3d_gpu_scene.h.
+        GPUScene gpu_scene;
+        std::vector<uint32_t> frame_draw_instances;  // instance id per meshlet_draws entry
+        std::vector<uint32_t> frame_group_instances;
         std::vector<const Mesh*> frame_mesh_order;
         std::unordered_map<const Mesh*, std::vector<uint32_t>> frame_draws_by_mesh;
-        std::vector<VkDrawMeshTasksIndirectCommandEXT> frame_indirect_cmds;
-        std::vector<GPUDrawData> frame_draw_data;
         VulkanContext* vk_context_cache = nullptr;
 
         uint32_t max_texture_slots = 0;
@@ -128,7 +124,8 @@ namespace Honey::Renderer3DInternal {
 
     using PipelineFactory = std::function<Ref<Pipeline>(void* rp, bool blend, bool cull_none)>;
 
-    GPUMaterial build_gpu_material(const Material* mat);
+    // Sets *out_textures_pending if a referenced texture has no bindless index yet.
+    GPUMaterial build_gpu_material(const Material* mat, bool* out_textures_pending = nullptr);
 
     Ref<Pipeline> get_or_create_meshlet_pipeline(void* rp_native, bool blend, bool cull_none);
     Ref<Pipeline> get_or_create_meshlet_gbuffer_pipeline(void* rp_native, bool cull_none);
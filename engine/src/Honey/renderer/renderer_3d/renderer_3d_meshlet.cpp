@@ -79,11 +79,21 @@ namespace Honey::Renderer3DInternal {
 
         CameraUBO saved_camera = VulkanRendererAPI::get_globals_state().cameraUBO;
 
-        auto& gpu_materials = g_renderer3d_data->frame_gpu_materials;
-        gpu_materials.clear();
-        gpu_materials.reserve(g_renderer3d_data->meshlet_draws.size());
-        for (const auto& cmd : g_renderer3d_data->meshlet_draws)
-            gpu_materials.push_back(build_gpu_material(cmd.material));
+        // Resolve every draw to its persistent material and instance slots. Materials whose
+        // version moved are patched into the global table once; instance data is only uploaded
+        // below, position by position, where the GPU copy is stale.
+        auto& gpu_scene = g_renderer3d_data->gpu_scene;
+        GPUScene::UploadStats upload{};
+        gpu_scene.begin_flush();
+
+        auto& draw_instances = g_renderer3d_data->frame_draw_instances;
+        draw_instances.resize(g_renderer3d_data->meshlet_draws.size());
+        for (uint32_t i = 0; i < (uint32_t)g_renderer3d_data->meshlet_draws.size(); ++i) {
+            const auto& cmd = g_renderer3d_data->meshlet_draws[i];
+            const uint32_t material_slot = gpu_scene.acquire_material(cmd.material);
+            draw_instances[i] = gpu_scene.acquire_instance(cmd, material_slot);
+        }
+        gpu_scene.flush_materials(upload);
 
         const bool deferred = Settings::get().renderer.renderer_type == RendererSettings::RendererType::deferred;
 
@@ -99,7 +109,6 @@ namespace Honey::Renderer3DInternal {
         }
 
         VulkanRendererAPI::submit_camera(saved_camera);
-        VulkanRendererAPI::submit_materials(gpu_materials, 0);
         VulkanRendererAPI::flush_globals_to_heap();
 
         auto& mesh_order = g_renderer3d_data->frame_mesh_order;
@@ -124,16 +133,18 @@ namespace Honey::Renderer3DInternal {
         auto& indirect_buffer = g_renderer3d_data->indirect_buffers[frame_slot];
         auto& count_buffer = g_renderer3d_data->count_buffers[frame_slot];
 
-        if (!indirect_buffer || indirect_buffer->get_size() < indirect_bytes)
+        bool indirect_fresh = !indirect_buffer || indirect_buffer->get_size() < indirect_bytes;
+        bool count_fresh = !count_buffer || count_buffer->get_size() < count_bytes;
+        if (indirect_fresh)
             indirect_buffer = StorageBuffer::create(indirect_bytes, StorageBufferUsage::Dynamic | StorageBufferUsage::Indirect);
-        if (!count_buffer || count_buffer->get_size() < count_bytes)
+        if (count_fresh)
             count_buffer = StorageBuffer::create(std::max(count_bytes, 4u), StorageBufferUsage::Dynamic | StorageBufferUsage::Indirect);
 
         auto indirect_vk = reinterpret_cast<VkBuffer>(indirect_buffer->get_native_buffer());
         auto count_vk = reinterpret_cast<VkBuffer>(count_buffer->get_native_buffer());
 
-        auto& indirect_cmds = g_renderer3d_data->frame_indirect_cmds;
-        auto& draw_data = g_renderer3d_data->frame_draw_data;
+        auto& group_instances = g_renderer3d_data->frame_group_instances;
+        const uint32_t ring_slot = VulkanRendererAPI::get_meshlet_frame_slot();
 
         uint32_t global_draw_offset = 0;
         uint32_t dispatch_counter = 0;
@@ -149,7 +160,11 @@ namespace Honey::Renderer3DInternal {
                            "flush_meshlet_draws: mesh has no global meshlet buffers");
             auto& bufs = const_cast<GlobalMeshletBuffers&>(*mesh->meshlet_buffers);
 
+            const Ref<StorageBuffer> previous_draw_data = VulkanRendererAPI::get_mesh_draw_data_buffer(bufs);
             VulkanRendererAPI::update_mesh_draw_data_binding(bufs, mesh_total_draws);
+            Ref<StorageBuffer> draw_data_buffer = VulkanRendererAPI::get_mesh_draw_data_buffer(bufs);
+            HN_CORE_ASSERT(draw_data_buffer, "flush_meshlet_draws: draw_data_buffer not available for frame slot");
+            bool draw_data_fresh = draw_data_buffer != previous_draw_data;
 
             std::unordered_map<uint8_t, std::vector<uint32_t>> draws_by_variant;
             std::vector<uint8_t> variant_order;
@@ -169,7 +184,12 @@ namespace Honey::Renderer3DInternal {
             }
 
             for (uint8_t variant : variant_order) {
-                const auto& variant_draws = draws_by_variant.at(variant);
+                auto& variant_draws = draws_by_variant.at(variant);
+                // Slot order keeps each instance at the same buffer position from frame to frame
+                // while the visible set is stable, which is what lets the uploads below skip it.
+                std::sort(variant_draws.begin(), variant_draws.end(), [&](uint32_t a, uint32_t b) {
+                    return draw_instances[a] < draw_instances[b];
+                });
                 const uint32_t mesh_draw_count = (uint32_t)variant_draws.size();
                 const bool blend = (variant & 1u) != 0u;
                 const bool cull_none = (variant & 2u) != 0u;
@@ -183,39 +203,21 @@ namespace Honey::Renderer3DInternal {
                     current_pipe = pipe;
                 }
 
-                indirect_cmds.clear();
-                draw_data.clear();
-                indirect_cmds.reserve(mesh_draw_count);
-                draw_data.reserve(mesh_draw_count);
+                group_instances.clear();
+                for (uint32_t draw_idx : variant_draws)
+                    group_instances.push_back(draw_instances[draw_idx]);
 
                 const uint32_t mesh_draw_base = mesh_local_draw_offset;
-                for (uint32_t local_i = 0; local_i < mesh_draw_count; ++local_i) {
-                    const uint32_t draw_idx = variant_draws[local_i];
-                    const auto& cmd = g_renderer3d_data->meshlet_draws[draw_idx];
-                    const auto& geo = cmd.submesh->meshlets;
-
-                    indirect_cmds.push_back({geo.meshlet_count, 1, 1});
-                    draw_data.push_back({
-                        cmd.transform,
-                        geo.meshlets_offset,
-                        geo.meshlet_count,
-                        (int32_t)draw_idx,
-                        cmd.entity_id,
-                    });
-                }
-
                 const uint32_t indirect_byte_off = global_draw_offset * 12u;
                 const uint32_t count_byte_off = dispatch_counter * (uint32_t)sizeof(uint32_t);
 
-                indirect_buffer->set_data(indirect_cmds.data(), mesh_draw_count * 12u, indirect_byte_off);
-                count_buffer->set_data(&mesh_draw_count, sizeof(uint32_t), count_byte_off);
-
-                Ref<StorageBuffer> draw_data_buffer = VulkanRendererAPI::get_mesh_draw_data_buffer(bufs);
-                HN_CORE_ASSERT(draw_data_buffer, "flush_meshlet_draws: draw_data_buffer not available for frame slot");
-                draw_data_buffer->set_data(
-                    draw_data.data(),
-                    mesh_draw_count * (uint32_t)sizeof(GPUDrawData),
-                    mesh_draw_base * (uint32_t)sizeof(GPUDrawData));
+                gpu_scene.upload_indirect(*indirect_buffer, frame_slot, indirect_fresh,
+                                          global_draw_offset, group_instances.data(), mesh_draw_count, upload);
+                gpu_scene.upload_count(*count_buffer, frame_slot, count_fresh,
+                                       dispatch_counter, mesh_draw_count, upload);
+                gpu_scene.upload_draw_data(mesh, *draw_data_buffer, ring_slot, draw_data_fresh,
+                                           mesh_draw_base, group_instances.data(), mesh_draw_count, upload);
+                indirect_fresh = count_fresh = draw_data_fresh = false;
 
                 const uint32_t mesh_block_offset = VulkanRendererAPI::get_mesh_block_offset(bufs);
 
@@ -245,6 +247,10 @@ namespace Honey::Renderer3DInternal {
                 dispatch_counter++;
             }
         }
+        g_renderer3d_data->stats.instances_patched += upload.instances_patched;
+        g_renderer3d_data->stats.materials_patched += upload.materials_patched;
+        g_renderer3d_data->stats.bytes_uploaded    += upload.bytes_uploaded;
+
         // meshlet_draws is intentionally NOT cleared here — begin_scene clears it.
         // shadow_draw_list is left populated for the shadow.draw executor.
     }
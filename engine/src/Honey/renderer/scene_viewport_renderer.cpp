@@ -245,6 +245,30 @@ namespace Honey {
         return picked.is_valid() ? picked : Entity{};
     }
 
+    Entity SceneViewportRenderer::pick_entity_bounds(uint32_t x, uint32_t y, Scene* scene,
+                                                     const glm::mat4& view, const glm::mat4& projection) const {
+        if (!scene || x >= m_width || y >= m_height)
+            return Entity{};
+
+        // Pixel centre -> NDC (y down in pixels, up in NDC), then unproject near/far points.
+        const float ndc_x = ((float)x + 0.5f) / (float)m_width * 2.0f - 1.0f;
+        const float ndc_y = 1.0f - ((float)y + 0.5f) / (float)m_height * 2.0f;
+        const glm::mat4 inv_view_proj = glm::inverse(projection * view);
+
+        glm::vec4 near_point = inv_view_proj * glm::vec4(ndc_x, ndc_y, -1.0f, 1.0f);
+        glm::vec4 far_point  = inv_view_proj * glm::vec4(ndc_x, ndc_y,  1.0f, 1.0f);
+        near_point /= near_point.w;
+        far_point  /= far_point.w;
+
+        const glm::vec3 origin(near_point);
+        const glm::vec3 to_far = glm::vec3(far_point) - origin;
+        const float length = glm::length(to_far);
+        if (length <= 0.0f)
+            return Entity{};
+
+        return scene->raycast_bounds(origin, to_far / length, length);
+    }
+
     void SceneViewportRenderer::log_debug_dump(const char* label) const {
         if (m_frame_graph)
             m_frame_graph->log_debug_dump(label);
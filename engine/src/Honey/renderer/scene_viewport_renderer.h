@@ -48,6 +48,10 @@ namespace Honey {
         ImTextureID get_imgui_texture_id() const;
         Ref<Framebuffer> get_output_framebuffer() const { return m_output_framebuffer; }
         Entity pick_entity(uint32_t x, uint32_t y, Scene* scene) const;
+        // CPU pick against the scene's spatial tree (entity bounds, not triangles). Needs no
+        // GPU readback, so it also works in modes that don't write the entity-ID attachment.
+        Entity pick_entity_bounds(uint32_t x, uint32_t y, Scene* scene,
+                                  const glm::mat4& view, const glm::mat4& projection) const;
         void log_debug_dump(const char* label) const;
 
         const FGExecutionStats& get_frame_graph_stats() const { return m_frame_graph_stats; }
@@ -170,8 +170,8 @@ namespace Honey {
                 tex->resize(decoded.width, decoded.height);
                 tex->set_data_streaming(decoded.pixels.data(),
                               decoded.width * decoded.height * 4);
-            });
-        });
+            }, MainPriority::low);
+        }, TaskLane::background);
 
         return tex;
     }
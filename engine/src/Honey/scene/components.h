@@ -46,7 +46,9 @@ namespace Honey {
         glm::vec3 rotation = {0.0f, 0.0f, 0.0f};
         glm::vec3 scale = {1.0f, 1.0f, 1.0f};
 
-        // For caching
+        // For caching. After editing translation/rotation/scale, call
+        // Scene::mark_transform_dirty, or at least raise `dirty`, so the world matrix gets
+        // recomputed.
         glm::mat4 local = glm::mat4(1.0f);
         glm::mat4 world = glm::mat4(1.0f);
 
@@ -256,6 +258,13 @@ namespace Honey {
         std::string script_name;
         bool initialized = false;
 
+        // Runtime only. Valid while script_generation matches CSharpScriptEngine::get_script_generation();
+        // a script reload bumps the generation, which drops both caches.
+        intptr_t instance = 0;          // GCHandle of the managed script, 0 if none
+        uint32_t script_generation = 0;
+        bool class_exists = false;
+        bool collision_listener = false; // the instance overrides a collision callback
+
         std::unordered_map<std::string, std::variant<
                                float,
                                bool,
@@ -263,7 +272,22 @@ namespace Honey {
                            >> property_overrides;
 
         ScriptComponent() = default;
-        ScriptComponent(const ScriptComponent&) = default;
+        // A copy is a separate script that needs its own instance and OnCreate, so only the
+        // authored fields carry over. Moves (storage compaction) keep the runtime state.
+        ScriptComponent(const ScriptComponent& other)
+            : script_name(other.script_name), property_overrides(other.property_overrides) {}
+        ScriptComponent& operator=(const ScriptComponent& other) {
+            script_name = other.script_name;
+            property_overrides = other.property_overrides;
+            initialized = false;
+            instance = 0;
+            script_generation = 0;
+            class_exists = false;
+            collision_listener = false;
+            return *this;
+        }
+        ScriptComponent(ScriptComponent&&) = default;
+        ScriptComponent& operator=(ScriptComponent&&) = default;
     };
 
 
@@ -285,6 +309,12 @@ namespace Honey {
 
         void* runtime_body = nullptr;
 
+        // Runtime — world pose after the last two fixed steps, blended for rendering.
+        glm::vec2 previous_position = { 0.0f, 0.0f };
+        glm::vec2 current_position  = { 0.0f, 0.0f };
+        float previous_angle = 0.0f;
+        float current_angle  = 0.0f;
+
         Rigidbody2DComponent() = default;
         Rigidbody2DComponent(const Rigidbody2DComponent&) = default;
     };
@@ -342,6 +372,12 @@ namespace Honey {
 
         // Runtime — not serialized
         uint32_t runtime_body_id = 0xFFFFFFFF;   // JPH::BodyID::cInvalidBodyID
+        // World pose after the last two fixed steps, blended for rendering.
+        glm::vec3 previous_position = { 0, 0, 0 };
+        glm::vec3 current_position  = { 0, 0, 0 };
+        glm::quat previous_rotation = { 1, 0, 0, 0 };
+        glm::quat current_rotation  = { 1, 0, 0, 0 };
+        glm::vec3 current_linear_velocity = { 0, 0, 0 };
 
         RigidbodyComponent() = default;
         RigidbodyComponent(const RigidbodyComponent&) = default;
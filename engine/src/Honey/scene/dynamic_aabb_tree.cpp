@@ -0,0 +1,238 @@
+#include "hnpch.h"
+#include "dynamic_aabb_tree.h"
+
+namespace Honey {
+
+    namespace {
+        Math::AABB merge(const Math::AABB& a, const Math::AABB& b) {
+            Math::AABB out = a;
+            out.expand(b);
+            return out;
+        }
+
+        Math::AABB fatten(const Math::AABB& aabb) {
+            const glm::vec3 margin(DynamicAABBTree::k_fat_margin);
+            return { aabb.min - margin, aabb.max + margin };
+        }
+    }
+
+    int32_t DynamicAABBTree::allocate_node() {
+        if (m_free_list == k_null_node) {
+            m_nodes.emplace_back();
+            return (int32_t)m_nodes.size() - 1;
+        }
+
+        const int32_t index = m_free_list;
+        m_free_list = m_nodes[index].next;
+        m_nodes[index] = Node{};
+        return index;
+    }
+
+    void DynamicAABBTree::free_node(int32_t node) {
+        HN_CORE_ASSERT(node >= 0 && node < (int32_t)m_nodes.size(), "DynamicAABBTree: bad node index");
+        m_nodes[node].next   = m_free_list;
+        m_nodes[node].height = -1;
+        m_nodes[node].entity = entt::null;
+        m_free_list = node;
+    }
+
+    int32_t DynamicAABBTree::create_proxy(const Math::AABB& aabb, entt::entity entity) {
+        const int32_t proxy = allocate_node();
+        Node& node  = m_nodes[proxy];
+        node.tight  = aabb;
+        node.aabb   = fatten(aabb);
+        node.entity = entity;
+        node.height = 0;
+
+        insert_leaf(proxy);
+        ++m_proxy_count;
+        return proxy;
+    }
+
+    void DynamicAABBTree::destroy_proxy(int32_t proxy) {
+        HN_CORE_ASSERT(m_nodes[proxy].is_leaf(), "DynamicAABBTree: destroy_proxy on an internal node");
+        remove_leaf(proxy);
+        free_node(proxy);
+        --m_proxy_count;
+    }
+
+    bool DynamicAABBTree::move_proxy(int32_t proxy, const Math::AABB& aabb) {
+        HN_CORE_ASSERT(m_nodes[proxy].is_leaf(), "DynamicAABBTree: move_proxy on an internal node");
+        Node& node = m_nodes[proxy];
+        node.tight = aabb;
+        if (node.aabb.contains(aabb))
+            return false;
+
+        remove_leaf(proxy);
+        m_nodes[proxy].aabb = fatten(aabb);
+        insert_leaf(proxy);
+        return true;
+    }
+
+    void DynamicAABBTree::clear() {
+        m_nodes.clear();
+        m_root = k_null_node;
+        m_free_list = k_null_node;
+        m_proxy_count = 0;
+    }
+
+    void DynamicAABBTree::insert_leaf(int32_t leaf) {
+        if (m_root == k_null_node) {
+            m_root = leaf;
+            m_nodes[leaf].parent = k_null_node;
+            return;
+        }
+
+        // Find the best sibling by descending along the cheapest surface-area path.
+        const Math::AABB leaf_aabb = m_nodes[leaf].aabb;
+        int32_t index = m_root;
+        while (!m_nodes[index].is_leaf()) {
+            const Node& node = m_nodes[index];
+            const int32_t child1 = node.child1;
+            const int32_t child2 = node.child2;
+
+            const float area = node.aabb.surface_area();
+            const float combined_area = merge(node.aabb, leaf_aabb).surface_area();
+
+            // Cost of creating a new parent for this node and the new leaf.
+            const float cost = 2.0f * combined_area;
+            // Minimum cost of pushing the leaf further down the tree.
+            const float inheritance_cost = 2.0f * (combined_area - area);
+
+            auto descend_cost = [&](int32_t child) {
+                const Node& c = m_nodes[child];
+                const float merged = merge(leaf_aabb, c.aabb).surface_area();
+                return c.is_leaf() ? merged + inheritance_cost
+                                   : (merged - c.aabb.surface_area()) + inheritance_cost;
+            };
+            const float cost1 = descend_cost(child1);
+            const float cost2 = descend_cost(child2);
+
+            if (cost < cost1 && cost < cost2)
+                break;
+
+            index = cost1 < cost2 ? child1 : child2;
+        }
+
+        const int32_t sibling = index;
+
+        // Create a new parent.
+        const int32_t old_parent = m_nodes[sibling].parent;
+        const int32_t new_parent = allocate_node();
+        m_nodes[new_parent].parent = old_parent;
+        m_nodes[new_parent].aabb   = merge(leaf_aabb, m_nodes[sibling].aabb);
+        m_nodes[new_parent].height = m_nodes[sibling].height + 1;
+        m_nodes[new_parent].child1 = sibling;
+        m_nodes[new_parent].child2 = leaf;
+        m_nodes[sibling].parent = new_parent;
+        m_nodes[leaf].parent    = new_parent;
+
+        if (old_parent != k_null_node) {
+            if (m_nodes[old_parent].child1 == sibling)
+                m_nodes[old_parent].child1 = new_parent;
+            else
+                m_nodes[old_parent].child2 = new_parent;
+        } else {
+            m_root = new_parent;
+        }
+
+        refit_upwards(new_parent);
+    }
+
+    void DynamicAABBTree::remove_leaf(int32_t leaf) {
+        if (leaf == m_root) {
+            m_root = k_null_node;
+            return;
+        }
+
+        const int32_t parent       = m_nodes[leaf].parent;
+        const int32_t grand_parent = m_nodes[parent].parent;
+        const int32_t sibling      = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+        if (grand_parent != k_null_node) {
+            // Destroy the parent and connect the sibling to the grandparent.
+            if (m_nodes[grand_parent].child1 == parent)
+                m_nodes[grand_parent].child1 = sibling;
+            else
+                m_nodes[grand_parent].child2 = sibling;
+            m_nodes[sibling].parent = grand_parent;
+            free_node(parent);
+
+            refit_upwards(grand_parent);
+        } else {
+            m_root = sibling;
+            m_nodes[sibling].parent = k_null_node;
+            free_node(parent);
+        }
+    }
+
+    void DynamicAABBTree::refit_upwards(int32_t index) {
+        while (index != k_null_node) {
+            index = balance(index);
+
+            Node& node = m_nodes[index];
+            const Node& c1 = m_nodes[node.child1];
+            const Node& c2 = m_nodes[node.child2];
+            node.height = 1 + glm::max(c1.height, c2.height);
+            node.aabb   = merge(c1.aabb, c2.aabb);
+
+            index = node.parent;
+        }
+    }
+
+    // Performs a left or right rotation if node A is imbalanced. Returns the new subtree root.
+    // The taller child U replaces A; A becomes U's child and adopts U's shorter child.
+    int32_t DynamicAABBTree::balance(int32_t i_a) {
+        if (m_nodes[i_a].is_leaf() || m_nodes[i_a].height < 2)
+            return i_a;
+
+        const int32_t i_b = m_nodes[i_a].child1;
+        const int32_t i_c = m_nodes[i_a].child2;
+        const int32_t height_diff = m_nodes[i_c].height - m_nodes[i_b].height;
+
+        int32_t i_up, i_other;
+        if (height_diff > 1) {
+            i_up = i_c; i_other = i_b;
+        } else if (height_diff < -1) {
+            i_up = i_b; i_other = i_c;
+        } else {
+            return i_a;
+        }
+
+        Node& a     = m_nodes[i_a];
+        Node& up    = m_nodes[i_up];
+        Node& other = m_nodes[i_other];
+
+        // U takes A's place under A's parent.
+        up.parent = a.parent;
+        a.parent  = i_up;
+        if (up.parent != k_null_node) {
+            Node& p = m_nodes[up.parent];
+            (p.child1 == i_a ? p.child1 : p.child2) = i_up;
+        } else {
+            m_root = i_up;
+        }
+
+        // U keeps its taller child; the shorter one moves under A where U used to be.
+        const int32_t i_f = up.child1;
+        const int32_t i_g = up.child2;
+        const bool f_taller = m_nodes[i_f].height > m_nodes[i_g].height;
+        const int32_t i_keep = f_taller ? i_f : i_g;
+        const int32_t i_move = f_taller ? i_g : i_f;
+        Node& keep = m_nodes[i_keep];
+        Node& move = m_nodes[i_move];
+
+        up.child1 = i_a;
+        up.child2 = i_keep;
+        (a.child1 == i_up ? a.child1 : a.child2) = i_move;
+        move.parent = i_a;
+
+        a.aabb    = merge(other.aabb, move.aabb);
+        a.height  = 1 + glm::max(other.height, move.height);
+        up.aabb   = merge(a.aabb, keep.aabb);
+        up.height = 1 + glm::max(a.height, keep.height);
+
+        return i_up;
+    }
+
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Honey/core/log.h"
+#include "Honey/math/math.h"
+
+#include <entt/entt.hpp>
+#include <vector>
+
+namespace Honey {
+
+    // Dynamic bounding-volume hierarchy over entity bounds (Box2D-style: SAH insertion,
+    // AVL rotations, fat leaves). A leaf keeps the tight box it was given plus a fattened
+    // copy in the tree, so small movements are absorbed without touching the hierarchy.
+    // Queries run against the fat boxes while descending and the tight box at the leaf.
+    class DynamicAABBTree {
+    public:
+        static constexpr int32_t k_null_node = -1;
+        // World-space padding applied to every leaf.
+        static constexpr float k_fat_margin = 0.1f;
+
+        DynamicAABBTree() = default;
+
+        int32_t create_proxy(const Math::AABB& aabb, entt::entity entity);
+        void destroy_proxy(int32_t proxy);
+        // Updates the tight box; reinserts only if it left the fat box. Returns true if reinserted.
+        bool move_proxy(int32_t proxy, const Math::AABB& aabb);
+
+        void clear();
+
+        entt::entity get_entity(int32_t proxy) const { return m_nodes[proxy].entity; }
+        const Math::AABB& get_tight_aabb(int32_t proxy) const { return m_nodes[proxy].tight; }
+        const Math::AABB& get_fat_aabb(int32_t proxy) const { return m_nodes[proxy].aabb; }
+
+        uint32_t get_proxy_count() const { return m_proxy_count; }
+        int32_t get_height() const { return m_root == k_null_node ? 0 : m_nodes[m_root].height; }
+
+        // Generic traversal. overlaps(const Math::AABB&) prunes subtrees and filters leaves;
+        // visit(entt::entity) returns false to stop the query.
+        template<typename OverlapFn, typename VisitFn>
+        void query(OverlapFn&& overlaps, VisitFn&& visit) const {
+            if (m_root == k_null_node)
+                return;
+
+            int32_t stack[k_stack_size];
+            int32_t count = 0;
+            stack[count++] = m_root;
+
+            while (count > 0) {
+                const Node& node = m_nodes[stack[--count]];
+                if (node.is_leaf()) {
+                    if (overlaps(node.tight) && !visit(node.entity))
+                        return;
+                    continue;
+                }
+                if (!overlaps(node.aabb))
+                    continue;
+
+                HN_CORE_ASSERT(count + 2 <= k_stack_size, "DynamicAABBTree: query stack overflow");
+                stack[count++] = node.child1;
+                stack[count++] = node.child2;
+            }
+        }
+
+        template<typename VisitFn>
+        void query(const Math::AABB& box, VisitFn&& visit) const {
+            query([&](const Math::AABB& b) { return b.overlaps(box); }, visit);
+        }
+
+        template<typename VisitFn>
+        void query(const Math::Frustum& frustum, VisitFn&& visit) const {
+            query([&](const Math::AABB& b) { return frustum.intersects(b); }, visit);
+        }
+
+        template<typename VisitFn>
+        void query_sphere(const glm::vec3& center, float radius, VisitFn&& visit) const {
+            query([&](const Math::AABB& b) { return b.overlaps_sphere(center, radius); }, visit);
+        }
+
+        // Visits leaves whose tight box the ray enters before max_distance, roughly nearest
+        // first. visit(entt::entity, float t_enter) returns a distance that clips the ray:
+        // return t_enter to keep only closer hits, max_distance to collect all, or < 0 to stop.
+        template<typename VisitFn>
+        void raycast(const glm::vec3& origin, const glm::vec3& direction, float max_distance, VisitFn&& visit) const {
+            if (m_root == k_null_node)
+                return;
+
+            const glm::vec3 inv_dir = 1.0f / direction;
+            int32_t stack[k_stack_size];
+            int32_t count = 0;
+            stack[count++] = m_root;
+
+            while (count > 0) {
+                const Node& node = m_nodes[stack[--count]];
+                float t = 0.0f;
+                if (node.is_leaf()) {
+                    if (!node.tight.intersects_ray(origin, inv_dir, max_distance, t))
+                        continue;
+                    const float new_max = visit(node.entity, t);
+                    if (new_max < 0.0f)
+                        return;
+                    max_distance = glm::min(max_distance, new_max);
+                    continue;
+                }
+                if (!node.aabb.intersects_ray(origin, inv_dir, max_distance, t))
+                    continue;
+
+                HN_CORE_ASSERT(count + 2 <= k_stack_size, "DynamicAABBTree: raycast stack overflow");
+                // Push the farther child first so the nearer one is popped first.
+                const float d1 = glm::dot(m_nodes[node.child1].aabb.center() - origin, direction);
+                const float d2 = glm::dot(m_nodes[node.child2].aabb.center() - origin, direction);
+                stack[count++] = d1 < d2 ? node.child2 : node.child1;
+                stack[count++] = d1 < d2 ? node.child1 : node.child2;
+            }
+        }
+
+    private:
+        static constexpr int32_t k_stack_size = 256;
+
+        struct Node {
+            Math::AABB aabb;   // fat box for leaves, union of children otherwise
+            Math::AABB tight;  // leaves only
+            entt::entity entity = entt::null;
+            union {
+                int32_t parent = k_null_node;
+                int32_t next; // free list
+            };
+            int32_t child1 = k_null_node;
+            int32_t child2 = k_null_node;
+            int32_t height = 0; // leaf = 0, free = -1
+
+            bool is_leaf() const { return child1 == k_null_node; }
+        };
+
+        int32_t allocate_node();
+        void free_node(int32_t node);
+        void insert_leaf(int32_t leaf);
+        void remove_leaf(int32_t leaf);
+        int32_t balance(int32_t a);
+        void refit_upwards(int32_t index);
+
+        std::vector<Node> m_nodes;
+        int32_t m_root = k_null_node;
+        int32_t m_free_list = k_null_node;
+        uint32_t m_proxy_count = 0;
+    };
+
+}
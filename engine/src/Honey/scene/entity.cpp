@@ -34,6 +34,11 @@ namespace Honey {
             }
         }
 
+        if (has_component<IDComponent>())
+            m_scene->m_entity_map.erase(get_component<IDComponent>().id);
+        m_scene->transform_order_remove(m_entity_handle);
+        m_scene->spatial_index_remove(m_entity_handle);
+
         m_scene->get_registry().destroy(m_entity_handle);
         m_entity_handle = entt::null;
     }
@@ -135,7 +140,8 @@ namespace Honey {
             // Null parent
             rel.parent = entt::null;
         }
-        m_scene->mark_dirty(); // invalidate the transform sort order cache
+        m_scene->transform_order_reparent(m_entity_handle);
+        m_scene->mark_dirty();
 
         if (!recompute_world_transform) return;
 
@@ -164,7 +170,8 @@ namespace Honey {
         }
         rel.parent = entt::null;
 
-        m_scene->mark_dirty(); // invalidate the transform sort order cache
+        m_scene->transform_order_reparent(m_entity_handle);
+        m_scene->mark_dirty();
 
         // Apply world as new local (since no parent)
         set_world_transform(world_before);
@@ -273,7 +280,7 @@ namespace Honey {
         tc.translation = T;
         tc.rotation    = R_euler; // radians
         tc.scale       = S;
-        tc.dirty       = true;
+        m_scene->mark_transform_dirty(m_entity_handle);
     }
 
     bool Entity::is_ancestor_of(Entity other) const {
@@ -8,6 +8,7 @@
 #include "entity.h"
 
 #include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
 #include <box2d/box2d.h>
 
 #include "scene_serializer.h"
@@ -35,6 +36,35 @@ namespace Honey {
         return b2_staticBody;
     }
 
+    // Box2D body user data holds the owning entity's entt handle (see create_physics_body).
+    static entt::entity body_user_entity(void* user_data) {
+        return (entt::entity)(uint32_t)(uintptr_t)user_data;
+    }
+
+    // Per-chunk output of submit_meshes_parallel (see on_update_render).
+    struct ParallelMeshSubmitScratch {
+        std::vector<std::vector<Renderer3D::MeshletDrawCommand>> chunks;
+        std::vector<uint32_t> culled;
+    };
+
+    // CPU visibility test applied before submission. The GBuffer and every shadow pass
+    // draw from the same list, so an instance is kept if the camera sees it *or* it can
+    // cast a shadow into what the camera sees; culling on the camera alone would drop
+    // off-screen casters.
+    struct MeshCullContext {
+        bool enabled = false;
+        Math::Frustum camera;
+
+        // Camera frustum with the far plane pulled in to the shadow distance — the union
+        // of all directional cascades. Casters are tested swept along the light direction.
+        bool directional_shadows = false;
+        Math::Frustum shadow_receivers;
+        glm::vec3 light_direction{0.0f};
+
+        // Point lights whose range sphere is on screen (xyz = position, w = range).
+        std::vector<glm::vec4> shadow_spheres;
+    };
+
     Scene* Scene::s_active_scene = nullptr;
 
     static void release_audio_for_entity(Entity entity) {
@@ -52,7 +82,77 @@ namespace Honey {
 
     Scene::Scene() {
         m_cloth_system = std::make_unique<ClothSystem>();
+        m_mesh_cull = std::make_unique<MeshCullContext>();
+        m_mesh_submit_scratch = std::make_unique<ParallelMeshSubmitScratch>();
         ClothSystem::register_frame_graph_executors();
+        connect_registry_signals();
+        build_update_stages();
+    }
+
+    void Scene::connect_registry_signals() {
+        m_registry.on_construct<MeshRendererComponent>().connect<&Scene::on_mesh_renderer_changed>(this);
+        m_registry.on_update<MeshRendererComponent>().connect<&Scene::on_mesh_renderer_changed>(this);
+    }
+
+    void Scene::on_mesh_renderer_changed(entt::registry&, entt::entity entity) {
+        m_spatial_refresh.push_back(entity);
+    }
+
+    void Scene::mark_bounds_dirty(entt::entity entity) {
+        m_spatial_refresh.push_back(entity);
+    }
+
+    void Scene::build_update_stages() {
+        // Scripts and collision callbacks run C# that may touch anything, create or destroy
+        // entities: they run alone. Audio drives the global mixer, which is not thread-safe, and
+        // physics drives the async Jolt step and its job pool; both stay on this thread. Streamed
+        // Assets may release the last reference to a GPU mesh, so it stays here too.
+        //
+        // Scene state that is not a component is declared as a resource: physics resolves parents
+        // through m_entity_map, queues collisions and raises transforms through
+        // mark_transform_dirty; streamed assets queue spatial refreshes.
+        //
+        // Cloth and render submission are not stages: they run from render(), once per viewport
+        // with that viewport's camera, after the update has finished.
+        m_scripts_stage = m_update_stages.add("Scripts", [this](Timestep ts) { on_update_scripts(ts); })
+            .exclusive()
+            .id();
+
+        m_audio_stage = m_update_stages.add("Audio", [this](Timestep ts) { on_update_audio(ts); })
+            .writes<AudioSourceComponent>()
+            .main_thread()
+            .id();
+
+        m_physics_stage = m_update_stages.add("Physics", [this](Timestep ts) { on_update_physics(ts); })
+            .reads<IDComponent, RelationshipComponent, ScriptComponent>()
+            .writes<TransformComponent, Rigidbody2DComponent, BoxCollider2DComponent, CircleCollider2DComponent,
+                    RigidbodyComponent, BoxCollider3DComponent, SphereCollider3DComponent, CapsuleCollider3DComponent>()
+            .reads_resource(&m_entity_map)
+            .writes_resource(&m_collision_handles)
+            .writes_resource(&m_dirty_transform_roots)
+            .main_thread()
+            .id();
+
+        m_collision_stage = m_update_stages.add("Collision Events", [this](Timestep) { flush_collision_events(); })
+            .exclusive()
+            .id();
+
+        m_update_stages.add("Streamed Assets", [this](Timestep) { update_streamed_assets(); })
+            .writes<MeshRendererComponent>()
+            .writes_resource(&m_spatial_refresh)
+            .main_thread();
+
+        // Flushes deferred script destroys first.
+        m_update_stages.add("Transforms", [this](Timestep) { update_world_transforms(); })
+            .exclusive();
+    }
+
+    void Scene::run_update_stages(Timestep ts, bool paused) {
+        m_update_stages.set_enabled(m_scripts_stage, !paused);
+        m_update_stages.set_enabled(m_audio_stage, !paused);
+        m_update_stages.set_enabled(m_physics_stage, !paused);
+        m_update_stages.set_enabled(m_collision_stage, !paused);
+        m_update_stages.run(ts);
     }
 
     Scene::~Scene() {
@@ -77,6 +177,9 @@ namespace Honey {
         entity.add_component<TransformComponent>();
         entity.add_component<TagComponent>(name.empty() ? "Entity" : name);
 
+        m_entity_map[uuid] = (entt::entity)entity;
+        transform_order_insert_root(entity);
+
         mark_dirty();
         return entity;
     }
@@ -116,6 +219,9 @@ namespace Honey {
 
         release_audio_for_entity(entity);
 
+        m_entity_map.erase(entity.get_uuid());
+        transform_order_remove(entity);
+        spatial_index_remove(entity);
         m_registry.destroy(entity);
         mark_dirty();
     }
@@ -127,14 +233,11 @@ namespace Honey {
     }
 
     Entity Scene::get_entity(UUID uuid) {
-        auto view = m_registry.view<IDComponent>();
-        for (auto e : view) {
-            auto& id = view.get<IDComponent>(e);
-            if (id.id == uuid)
-                return Entity{ e, this };
-        }
+        auto it = m_entity_map.find(uuid);
+        if (it == m_entity_map.end() || !m_registry.valid(it->second))
+            return {};
 
-        return {};
+        return Entity{ it->second, this };
     }
 
     Entity Scene::find_entity_by_name(const std::string& name) {
@@ -147,6 +250,10 @@ namespace Honey {
     }
 
     void Scene::on_physics_2D_start() {
+        m_physics_2d_clock.reset();
+        m_moving_bodies_2d.clear();
+        m_settled_bodies_2d.clear();
+
         b2WorldDef world_def = b2DefaultWorldDef();
         world_def.gravity = {0.0f, -9.81f};
         m_world = b2CreateWorld(&world_def);
@@ -167,6 +274,9 @@ namespace Honey {
     }
 
     void Scene::on_physics_3D_start() {
+        m_physics_3d_clock.reset();
+        m_moving_bodies_3d.clear();
+        m_settled_bodies_3d.clear();
         PhysicsEngine3D::get().on_scene_start(this);
     }
 
@@ -286,16 +396,7 @@ namespace Honey {
 
     void Scene::on_update_runtime(Timestep ts, bool paused) {
         s_active_scene = this;
-
-        if (!paused) {
-            on_update_scripts(ts);
-            on_update_audio(ts);
-            on_update_physics_2d(ts);
-            on_update_physics_3d(ts);
-        }
-
-        update_world_transforms();
-        update_streamed_assets();
+        run_update_stages(ts, paused);
     }
 
     void Scene::on_update_editor(Timestep ts, EditorCamera& camera) {
@@ -303,23 +404,14 @@ namespace Honey {
 
         s_active_scene = this;
 
-        update_world_transforms();
-
         update_streamed_assets();
+
+        update_world_transforms();
     }
 
     void Scene::on_update_simulation(Timestep ts, EditorCamera& camera, bool paused) {
         s_active_scene = this;
-
-        if (!paused) {
-            on_update_scripts(ts);
-            on_update_audio(ts);
-            on_update_physics_2d(ts);
-            on_update_physics_3d(ts);
-        }
-
-        update_world_transforms();
-        update_streamed_assets();
+        run_update_stages(ts, paused);
     }
 
     void Scene::render(const glm::mat4& view, const glm::mat4& projection, const glm::mat4& view_proj, const glm::vec3& camera_pos,
@@ -343,16 +435,14 @@ namespace Honey {
         }
     }
 
+    // Copies one component storage onto the same entity ids in dst; both registries must
+    // already agree on which entities exist.
     template<typename Component>
-    static void copy_component(entt::registry& dst, const entt::registry& src, std::unordered_map<UUID, entt::entity> entt_map) {
+    static void copy_storage(entt::registry& dst, const entt::registry& src) {
         auto view = src.view<Component>();
-        for (auto e : view) {
-            UUID uuid = src.get<IDComponent>(e).id;
-            entt::entity dst_entt_id = entt_map.at(uuid);
-
-            auto& component = src.get<Component>(e);
-            dst.emplace_or_replace<Component>(dst_entt_id, component);
-        }
+        dst.storage<Component>().reserve(view.size());
+        for (auto e : view)
+            dst.emplace<Component>(e, view.get<Component>(e));
     }
 
     template<typename Component>
@@ -364,78 +454,123 @@ namespace Honey {
 
     Ref<Scene> Scene::copy(Ref<Scene> source) {
         Ref<Scene> copy = CreateRef<Scene>();
+        copy->copy_from(*source);
+        return copy;
+    }
 
-        auto& src_scene_registry = source->get_registry();
-        auto& dst_scene_registry = copy->get_registry();
-        std::unordered_map<UUID, entt::entity> entt_map;
+    void Scene::restore(const Scene& snapshot) {
+        HN_CORE_ASSERT(&snapshot != this, "Scene::restore: cannot restore a scene from itself");
+        copy_from(snapshot);
+    }
 
-        auto id_view = src_scene_registry.view<IDComponent>();
-        for (auto e : id_view) {
-            const auto& tag = src_scene_registry.get<TagComponent>(e).tag;
-            UUID uuid = src_scene_registry.get<IDComponent>(e).id;
-            Entity new_entity = copy->create_entity(tag, uuid);
-            entt_map[uuid] = (entt::entity)new_entity;
+    void Scene::release_runtime_resources() {
+        // Physics bodies and script instances belong to the runtime, which releases them all when
+        // it stops; whatever ids the components still hold afterwards are stale.
+        HN_CORE_ASSERT(!b2World_IsValid(m_world), "Scene: stop the runtime before replacing the registry");
+        HN_CORE_ASSERT(PhysicsEngine3D::get().get_scene() != this, "Scene: stop the runtime before replacing the registry");
+        HN_CORE_ASSERT(CSharpScriptEngine::get_scene_context() != this, "Scene: stop the runtime before replacing the registry");
+
+        // Audio sources outlive AudioSystem::shutdown and are freed one by one.
+        auto sources = m_registry.view<AudioSourceComponent>();
+        for (auto e : sources) {
+            auto& audio = sources.get<AudioSourceComponent>(e);
+            if (audio.runtime_handle) {
+                AudioSystem::destroy_source(audio.runtime_handle);
+                audio.runtime_handle = nullptr;
+            }
         }
+    }
 
-        copy_component<TransformComponent>          (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<CameraComponent>             (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<SpriteRendererComponent>     (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<CircleRendererComponent>     (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<LineRendererComponent>       (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<TextRendererComponent>       (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<MeshRendererComponent>       (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<NativeScriptComponent>       (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<ScriptComponent>             (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<Rigidbody2DComponent>        (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<BoxCollider2DComponent>      (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<CircleCollider2DComponent>   (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<RigidbodyComponent>          (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<BoxCollider3DComponent>      (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<SphereCollider3DComponent>   (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<CapsuleCollider3DComponent>  (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<AudioSourceComponent>        (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<ClothComponent>              (dst_scene_registry, src_scene_registry, entt_map);
-
-        copy_component<PointLightComponent>         (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<DirectionalLightComponent>   (dst_scene_registry, src_scene_registry, entt_map);
-        copy_component<SpotLightComponent>          (dst_scene_registry, src_scene_registry, entt_map);
-
-        auto view = src_scene_registry.view<RelationshipComponent>();
-        for (auto e : view) {
-            const auto& srcRel = src_scene_registry.get<RelationshipComponent>(e);
-
-            if (srcRel.parent == entt::null)
-                continue;
+    void Scene::copy_from(const Scene& source) {
+        HN_PROFILE_FUNCTION();
 
-            UUID childUUID  = src_scene_registry.get<IDComponent>(e).id;
-            UUID parentUUID = src_scene_registry.get<IDComponent>(srcRel.parent).id;
+        release_runtime_resources();
 
-            Entity child  = { entt_map.at(childUUID), copy.get() };
-            Entity parent = { entt_map.at(parentUUID), copy.get() };
+        const auto& src = source.m_registry;
+        m_registry = entt::registry{};
+        connect_registry_signals();
 
-            child.set_parent(parent, false);
+        // Same entity ids as the source, so everything keyed by entity (hierarchy links, the
+        // transform order, spatial proxies) carries over without a remap or a rebuild.
+        auto entities = src.view<entt::entity>();
+        for (auto e : entities) {
+            [[maybe_unused]] const entt::entity created = m_registry.create(e);
+            HN_CORE_ASSERT(created == e, "Scene copy: entity id not preserved");
         }
 
-        auto src_view = src_scene_registry.view<CameraComponent>();
-        for (auto e : src_view) {
-            auto& src_camera = src_view.get<CameraComponent>(e);
-            if (src_camera.primary) {
-                UUID uuid = src_scene_registry.get<IDComponent>(e).id;
-                if (entt_map.contains(uuid)) {
-                    Entity new_primary = { entt_map[uuid], copy.get() };
-                    auto& dst_camera = new_primary.get_component<CameraComponent>();
-                    dst_camera.primary = true;
-                }
-                break;
-            }
+        copy_storage<IDComponent>                 (m_registry, src);
+        copy_storage<TagComponent>                (m_registry, src);
+        copy_storage<TransformComponent>          (m_registry, src);
+        copy_storage<RelationshipComponent>       (m_registry, src);
+
+        copy_storage<CameraComponent>             (m_registry, src);
+        copy_storage<SpriteRendererComponent>     (m_registry, src);
+        copy_storage<CircleRendererComponent>     (m_registry, src);
+        copy_storage<LineRendererComponent>       (m_registry, src);
+        copy_storage<TextRendererComponent>       (m_registry, src);
+        copy_storage<IconRendererComponent>       (m_registry, src);
+        copy_storage<MeshRendererComponent>       (m_registry, src);
+
+        copy_storage<NativeScriptComponent>       (m_registry, src);
+        copy_storage<ScriptComponent>             (m_registry, src);
+
+        copy_storage<Rigidbody2DComponent>        (m_registry, src);
+        copy_storage<BoxCollider2DComponent>      (m_registry, src);
+        copy_storage<CircleCollider2DComponent>   (m_registry, src);
+        copy_storage<RigidbodyComponent>          (m_registry, src);
+        copy_storage<BoxCollider3DComponent>      (m_registry, src);
+        copy_storage<SphereCollider3DComponent>   (m_registry, src);
+        copy_storage<CapsuleCollider3DComponent>  (m_registry, src);
+
+        copy_storage<AudioSourceComponent>        (m_registry, src);
+
+        copy_storage<ClothComponent>              (m_registry, src);
+
+        copy_storage<PointLightComponent>         (m_registry, src);
+        copy_storage<DirectionalLightComponent>   (m_registry, src);
+        copy_storage<SpotLightComponent>          (m_registry, src);
+
+        // CameraComponent's copy constructor leaves these at their defaults.
+        auto cameras = src.view<CameraComponent>();
+        for (auto e : cameras) {
+            const auto& src_camera = cameras.get<CameraComponent>(e);
+            auto& dst_camera = m_registry.get<CameraComponent>(e);
+            dst_camera.primary  = src_camera.primary;
+            dst_camera.exposure = src_camera.exposure;
         }
 
-        return copy;
+        // Runtime handles stay with the source, which releases them; the copy starts without any.
+        auto audio_sources = m_registry.view<AudioSourceComponent>();
+        for (auto e : audio_sources)
+            audio_sources.get<AudioSourceComponent>(e).runtime_handle = nullptr;
+        auto bodies_2d = m_registry.view<Rigidbody2DComponent>();
+        for (auto e : bodies_2d)
+            bodies_2d.get<Rigidbody2DComponent>(e).runtime_body = nullptr;
+        auto bodies_3d = m_registry.view<RigidbodyComponent>();
+        for (auto e : bodies_3d)
+            bodies_3d.get<RigidbodyComponent>(e).runtime_body_id = 0xFFFFFFFF; // JPH::BodyID::cInvalidBodyID
+
+        m_entity_map = source.m_entity_map;
+        m_scene_state = source.m_scene_state;
+
+        m_transform_levels       = source.m_transform_levels;
+        m_transform_order_index  = source.m_transform_order_index;
+        m_transform_order_holes  = source.m_transform_order_holes;
+        m_transform_order_valid  = source.m_transform_order_valid;
+        m_dirty_transform_roots  = source.m_dirty_transform_roots;
+        m_world_dirty_entities   = source.m_world_dirty_entities;
+        m_world_dirty_everywhere = source.m_world_dirty_everywhere;
+
+        m_spatial_tree    = source.m_spatial_tree;
+        m_spatial_proxies = source.m_spatial_proxies;
+        // The copies above queued every mesh renderer; the copied tree is already up to date.
+        m_spatial_refresh = source.m_spatial_refresh;
+
+        m_change_version = source.m_change_version;
+
+        // Leases point into the storage that was just replaced.
+        m_leased_transforms.clear();
+        m_deferred_destroys.clear();
     }
 
     Entity Scene::duplicate_entity_recursive(Entity source, Entity new_parent, bool is_root) {
@@ -576,10 +711,13 @@ namespace Honey {
 
         b2BodyId body = b2CreateBody(m_world, &body_def);
 
-        b2Body_SetUserData(body, (void*)(uint64_t)entity.get_uuid());
+        // The entt handle, not the UUID: contact and move events resolve it without a lookup.
+        b2Body_SetUserData(body, (void*)entity);
         b2Body_SetMotionLocks(body, { false, false, rb->fixed_rotation });
 
         memcpy(&rb->runtime_body, &body, sizeof(b2BodyId));
+        rb->previous_position = rb->current_position = { world_translation.x, world_translation.y };
+        rb->previous_angle    = rb->current_angle    = world_rotation.z;
 
         // ---- COMPOUND COLLIDERS ----
         std::vector<Entity> collider_entities;
@@ -662,6 +800,7 @@ namespace Honey {
                     if (handle->done.load(std::memory_order_acquire)) {
                         if (!handle->failed.load(std::memory_order_acquire) && handle->mesh) {
                             mr.mesh = handle->mesh;
+                            scene->mark_bounds_dirty(e);
                         } else {
                             HN_CORE_WARN("Async mesh load failed for '{}'",
                                          mr.mesh_path.string());
@@ -675,11 +814,13 @@ namespace Honey {
                     auto& handle = mr.gltf_async_handle;
                     if (handle->done.load(std::memory_order_acquire)) {
                         if (!handle->failed.load(std::memory_order_acquire)) {
-                            if (const GltfNode* node = find_node_by_name(handle->tree, mr.gltf_node_name))
+                            if (const GltfNode* node = find_node_by_name(handle->tree, mr.gltf_node_name)) {
                                 mr.mesh = node->mesh;
-                            else
+                                scene->mark_bounds_dirty(e);
+                            } else {
                                 HN_CORE_WARN("gltf_async: node '{}' not found in '{}'",
                                              mr.gltf_node_name, mr.gltf_source_path.string());
+                            }
                         } else {
                             HN_CORE_WARN("gltf_async: load failed for '{}'", mr.gltf_source_path.string());
                         }
@@ -690,6 +831,105 @@ namespace Honey {
         }
     }
 
+    namespace {
+        // Entities per parallel submission chunk. Chunks (not worker threads) own the
+        // output lists, so the merged draw order is identical to the serial loop no
+        // matter how enkiTS schedules them.
+        constexpr uint32_t k_mesh_submit_chunk_size = 256;
+
+        bool cull_accepts(const MeshCullContext& cull, const Math::AABB& world) {
+            if (cull.camera.intersects(world))
+                return true;
+            if (cull.directional_shadows && cull.shadow_receivers.intersects_swept(world, cull.light_direction))
+                return true;
+            for (const auto& sphere : cull.shadow_spheres) {
+                if (world.overlaps_sphere(glm::vec3(sphere), sphere.w))
+                    return true;
+            }
+            return false;
+        }
+
+        bool is_submesh_visible(const MeshCullContext& cull, const Submesh& sm, const glm::mat4& transform) {
+            if (!cull.enabled || !sm.bounds.is_valid())
+                return true;
+            return cull_accepts(cull, sm.bounds.transformed(transform));
+        }
+
+        // `scratch` is reused across frames so steady-state submission doesn't allocate.
+        void submit_meshes_parallel(entt::registry& registry, const std::vector<entt::entity>& entities,
+                                    const MeshCullContext& cull, ParallelMeshSubmitScratch& scratch) {
+            auto mesh_view = registry.view<TransformComponent, MeshRendererComponent>();
+
+            if (entities.empty())
+                return;
+
+            const uint32_t entity_count = (uint32_t)entities.size();
+            const uint32_t chunk_count = (entity_count + k_mesh_submit_chunk_size - 1) / k_mesh_submit_chunk_size;
+            if (scratch.chunks.size() < chunk_count) {
+                scratch.chunks.resize(chunk_count);
+                scratch.culled.resize(chunk_count);
+            }
+
+            // Workers only read components and write to their own chunk list.
+            auto build_chunk = [&](uint32_t chunk) {
+                auto& out = scratch.chunks[chunk];
+                out.clear();
+                uint32_t culled = 0;
+
+                const uint32_t first = chunk * k_mesh_submit_chunk_size;
+                const uint32_t last = std::min(first + k_mesh_submit_chunk_size, entity_count);
+                for (uint32_t i = first; i < last; ++i) {
+                    const entt::entity entity = entities[i];
+                    const auto& tc = mesh_view.get<TransformComponent>(entity);
+                    const auto& mr = mesh_view.get<MeshRendererComponent>(entity);
+                    if (!mr.mesh)
+                        continue;
+
+                    const auto& submeshes = mr.mesh->get_submeshes();
+                    const auto& overrides = mr.material_overrides;
+                    for (size_t s = 0; s < submeshes.size(); ++s) {
+                        const auto& sm = submeshes[s];
+                        const Ref<Material>& material =
+                            (s < overrides.size() && overrides[s]) ? overrides[s] : sm.material;
+                        HN_CORE_ASSERT(material, "submit_meshes_parallel: material is null");
+
+                        const glm::mat4 transform = tc.world * sm.transform;
+                        if (!is_submesh_visible(cull, sm, transform)) {
+                            ++culled;
+                            continue;
+                        }
+
+                        out.push_back({
+                            .submesh = &sm,
+                            .mesh = mr.mesh.get(),
+                            .material = material.get(),
+                            .transform = transform,
+                            .entity_id = (int)entity,
+                        });
+                    }
+                }
+                scratch.culled[chunk] = culled;
+            };
+
+            TaskHandle handle = TaskSystem::parallel_for(0, chunk_count, build_chunk, 1, TaskLane::frame_critical);
+            if (handle) {
+                TaskSystem::wait(handle);
+            } else {
+                // TaskSystem not running (e.g. headless tools) — same work, inline.
+                for (uint32_t chunk = 0; chunk < chunk_count; ++chunk)
+                    build_chunk(chunk);
+            }
+
+            uint32_t culled = 0;
+            for (uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+                const auto& cmds = scratch.chunks[chunk];
+                Renderer3D::submit_draw_commands(cmds.data(), cmds.size());
+                culled += scratch.culled[chunk];
+            }
+            Renderer3D::record_culled_submissions(culled);
+        }
+    }
+
     void Scene::on_update_scripts(Timestep ts) {
         //auto view = m_registry.view<ScriptComponent>();
         //for (auto e : view) {
@@ -702,29 +942,50 @@ namespace Honey {
         //    ScriptEngine::on_update_entity(entity, ts);
         //}
         auto view = m_registry.view<ScriptComponent>();
-        std::vector<entt::entity> script_entities;
-        script_entities.reserve(view.size());
+        m_script_entities.assign(view.begin(), view.end());
+        m_script_handles.clear();
 
-        for (auto e : view)
-            script_entities.push_back(e);
+        const uint32_t generation = CSharpScriptEngine::get_script_generation();
 
-        for (auto e : script_entities) {
+        // OnCreate runs one entity at a time, since it may spawn or destroy entities.
+        for (auto e : m_script_entities) {
             if (!m_registry.valid(e))
                 continue;
 
-            Entity entity = { e, this };
-            auto& sc = entity.get_component<ScriptComponent>();
+            auto* sc = m_registry.try_get<ScriptComponent>(e);
+            if (!sc)
+                continue;
+
+            if (sc->script_generation != generation) {
+                // Scripts were (re)loaded since this component was last seen: the old instance is
+                // gone and the class may have appeared or disappeared.
+                sc->script_generation = generation;
+                sc->class_exists = CSharpScriptEngine::entity_class_exists(sc->script_name);
+                sc->instance = 0;
+                sc->collision_listener = false;
+                sc->initialized = false;
+            }
 
-            if (!sc.initialized) {
-                if (CSharpScriptEngine::entity_class_exists(sc.script_name))
-                    CSharpScriptEngine::on_create_entity(entity);
-                sc.initialized = true;
+            if (!sc->initialized) {
+                sc->initialized = true;
+                if (sc->class_exists)
+                    CSharpScriptEngine::on_create_entity({ e, this });
             }
+        }
+
+        // Gathered only after every OnCreate, so no handle can be freed before the batch runs.
+        for (auto e : m_script_entities) {
+            if (!m_registry.valid(e))
+                continue;
 
-            if (CSharpScriptEngine::entity_class_exists(sc.script_name))
-                CSharpScriptEngine::on_update_entity(entity, ts);
+            const auto* sc = m_registry.try_get<ScriptComponent>(e);
+            if (sc && sc->instance)
+                m_script_handles.push_back(sc->instance);
         }
 
+        CSharpScriptEngine::on_update_entities(m_script_handles.data(), (uint32_t)m_script_handles.size(), ts);
+        flush_script_writes();
+
         // C++ scripts
         m_registry.view<NativeScriptComponent>().each([this, ts](auto entity, auto& nsc) {
             if (!nsc.instance) {
@@ -767,131 +1028,191 @@ namespace Honey {
         AudioSystem::on_update(ts);
     }
 
-    void Scene::on_update_physics_2d(Timestep ts) {
-        // Box2D handles its own multithreading
-        auto& physics_settings = Settings::get().physics;
-        if (physics_settings.enabled) {
-            // Sync physics bodies with their transforms if needed
-            for (auto e : m_registry.view<TransformComponent, Rigidbody2DComponent>()) {
-                Entity entity = { e, this };
-                auto& tc = entity.get_component<TransformComponent>();
-                if (tc.dirty) {
-                    auto& rb = entity.get_component<Rigidbody2DComponent>();
-
-                    b2BodyId body;
-                    memcpy(&body, &rb.runtime_body, sizeof(b2BodyId));
-
-                    b2Body_SetTransform(body, { tc.translation.x, tc.translation.y }, b2MakeRot(tc.rotation.z));
-                    tc.dirty = false;
-                }
+    void Scene::on_update_physics(Timestep ts) {
+        auto& settings = Settings::get().physics;
+        if (!settings.enabled)
+            return;
 
-                if (tc.collider_dirty) {
-                    rebuild_colliders(this, entity);
-                    tc.collider_dirty = false;
-                }
-            }
+        const float step = 1.0f / std::max(settings.tick_rate, 1.0f);
+        const uint32_t max_steps = (uint32_t)std::max(settings.max_steps_per_frame, 1);
 
-            const int32_t sub_steps = physics_settings.substeps;
+        // Separate clocks: the 3D world may run a step ahead on a worker (see on_update_physics_3d).
+        const uint32_t steps_2d = m_physics_2d_clock.advance(ts, step, max_steps);
+        on_update_physics_2d(steps_2d, step, settings.interpolate ? m_physics_2d_clock.alpha() : 1.0f);
+        on_update_physics_3d(ts, step, max_steps);
+    }
 
-            if (b2World_IsValid(m_world)) {
-                b2World_Step(m_world, ts, sub_steps);
-            }
+    void Scene::queue_collision(entt::entity a, entt::entity b, bool begin) {
+        // Either side may have been destroyed since the step reported the contact.
+        if (!m_registry.valid(a) || !m_registry.valid(b))
+            return;
 
-            b2ContactEvents events = b2World_GetContactEvents(m_world);
+        auto queue = [&](entt::entity receiver, entt::entity other) {
+            const auto* sc = m_registry.try_get<ScriptComponent>(receiver);
+            if (!sc || !sc->instance || !sc->collision_listener)
+                return;
+            m_collision_handles.push_back(sc->instance);
+            m_collision_other_ids.push_back((uint64_t)m_registry.get<IDComponent>(other).id);
+            m_collision_begins.push_back(begin ? 1 : 0);
+        };
+        queue(a, b);
+        queue(b, a);
+    }
 
-            for (int i = 0; i < events.beginCount; i++) {
-                b2ContactBeginTouchEvent* evt = &events.beginEvents[i];
+    void Scene::flush_collision_events() {
+        if (m_collision_handles.empty())
+            return;
 
-                b2BodyId body_a = b2Shape_GetBody(evt->shapeIdA);
-                b2BodyId body_b = b2Shape_GetBody(evt->shapeIdB);
+        CSharpScriptEngine::on_collisions(m_collision_handles.data(), m_collision_other_ids.data(),
+                                          m_collision_begins.data(), (uint32_t)m_collision_handles.size());
+        m_collision_handles.clear();
+        m_collision_other_ids.clear();
+        m_collision_begins.clear();
+        flush_script_writes();
+    }
 
-                UUID uuid_a = (uint64_t)b2Body_GetUserData(body_a);
-                UUID uuid_b = (uint64_t)b2Body_GetUserData(body_b);
+    void Scene::on_update_physics_2d(uint32_t steps, float step, float alpha) {
+        // Box2D handles its own multithreading
+        if (!b2World_IsValid(m_world))
+            return;
 
-                Entity entity_a = get_entity(uuid_a);
-                Entity entity_b = get_entity(uuid_b);
+        auto bodies = m_registry.view<TransformComponent, Rigidbody2DComponent>();
 
-                if (entity_a.is_valid() && entity_b.is_valid()) {
-                    auto dispatch_begin = [&](Entity a, Entity b) {
-                        if (a.has_component<ScriptComponent>())
-                            CSharpScriptEngine::on_collision_begin(a, b);
-                    };
-                    dispatch_begin(entity_a, entity_b);
-                    dispatch_begin(entity_b, entity_a);
-                }
-            }
-            for (int i = 0; i < events.endCount; i++) {
-                b2ContactEndTouchEvent* evt = &events.endEvents[i];
+        // Sync physics bodies with their transforms if needed
+        for (auto e : bodies) {
+            Entity entity = { e, this };
+            auto& tc = bodies.get<TransformComponent>(e);
+            if (tc.dirty) {
+                auto& rb = bodies.get<Rigidbody2DComponent>(e);
 
-                b2BodyId body_a = b2Shape_GetBody(evt->shapeIdA);
-                b2BodyId body_b = b2Shape_GetBody(evt->shapeIdB);
+                b2BodyId body;
+                memcpy(&body, &rb.runtime_body, sizeof(b2BodyId));
 
-                UUID uuid_a = (uint64_t)b2Body_GetUserData(body_a);
-                UUID uuid_b = (uint64_t)b2Body_GetUserData(body_b);
+                b2Body_SetTransform(body, { tc.translation.x, tc.translation.y }, b2MakeRot(tc.rotation.z));
+                tc.dirty = false;
 
-                Entity entity_a = get_entity(uuid_a);
-                Entity entity_b = get_entity(uuid_b);
+                // Moved from outside the simulation: snap instead of blending from the old pose.
+                rb.previous_position = rb.current_position = { tc.translation.x, tc.translation.y };
+                rb.previous_angle    = rb.current_angle    = tc.rotation.z;
+            }
+
+            if (tc.collider_dirty) {
+                rebuild_colliders(this, entity);
+                tc.collider_dirty = false;
+            }
+        }
 
-                if (entity_a.is_valid() && entity_b.is_valid()) {
-                    auto dispatch_end = [&](Entity a, Entity b) {
-                        if (a.has_component<ScriptComponent>())
-                            CSharpScriptEngine::on_collision_end(a, b);
-                    };
-                    dispatch_end(entity_a, entity_b);
-                    dispatch_end(entity_b, entity_a);
+        // Only bodies Box2D reports as moved touch the ECS. Bodies that moved in the step before
+        // but not in this one get a last write at their final pose, then drop out.
+        auto store_moved_poses = [&]() {
+            for (auto e : m_moving_bodies_2d) {
+                if (auto* rb = m_registry.try_get<Rigidbody2DComponent>(e)) {
+                    rb->previous_position = rb->current_position;
+                    rb->previous_angle    = rb->current_angle;
+                    m_settled_bodies_2d.push_back(e);
                 }
             }
+            m_moving_bodies_2d.clear();
+
+            const b2BodyEvents body_events = b2World_GetBodyEvents(m_world);
+            for (int i = 0; i < body_events.moveCount; i++) {
+                const b2BodyMoveEvent& move = body_events.moveEvents[i];
+                const entt::entity entity = body_user_entity(move.userData);
+                auto* rb = m_registry.valid(entity) ? m_registry.try_get<Rigidbody2DComponent>(entity) : nullptr;
+                if (!rb)
+                    continue;
 
-            auto view = m_registry.view<Rigidbody2DComponent>();
-            for (auto e : view) {
-                Entity entity = { e, this };
-                auto& tc = entity.get_component<TransformComponent>();
-                auto& rb = entity.get_component<Rigidbody2DComponent>();
+                rb->previous_position = rb->current_position;
+                rb->previous_angle    = rb->current_angle;
+                rb->current_position  = { move.transform.p.x, move.transform.p.y };
+                rb->current_angle     = b2Rot_GetAngle(move.transform.q);
+                m_moving_bodies_2d.push_back(entity);
+            }
+        };
 
-                b2BodyId body;
-                memcpy(&body, &rb.runtime_body, sizeof(b2BodyId));
+        const int32_t sub_steps = Settings::get().physics.substeps;
+        for (uint32_t n = 0; n < steps; ++n) {
+            b2World_Step(m_world, step, sub_steps);
+            store_moved_poses();
 
-                if (!b2Body_IsValid(body))
-                    continue;
+            // Contact events only cover the step that just ran.
+            b2ContactEvents events = b2World_GetContactEvents(m_world);
 
-                b2Transform bt = b2Body_GetTransform(body);
-                glm::vec3 world_pos(bt.p.x, bt.p.y, tc.translation.z);
-                float world_rot = b2Rot_GetAngle(bt.q);
+            // Only scripts that override a collision callback hear about contacts; the scan is
+            // skipped entirely while no entity has a script.
+            if (m_registry.storage<ScriptComponent>().empty())
+                continue;
 
-                if (!entity.has_parent()) {
-                    // Root Rigidbody: world == local
-                    tc.translation = world_pos;
-                    tc.rotation.z = world_rot;
-                } else {
-                    // Child Rigidbody: convert world → local
-                    Entity parent = entity.get_parent();
-                    glm::mat4 parent_world = parent.get_world_transform();
-                    glm::mat4 inv_parent = glm::inverse(parent_world);
-
-                    glm::mat4 world =
-                        glm::translate(glm::mat4(1.0f), world_pos) *
-                        glm::rotate(glm::mat4(1.0f), world_rot, {0,0,1});
-
-                    glm::mat4 local = inv_parent * world;
-
-                    Math::decompose_transform(
-                        local,
-                        tc.translation,
-                        tc.rotation,
-                        tc.scale
-                    );
-                }
-                tc.dirty = true;
+            for (int i = 0; i < events.beginCount; i++) {
+                const b2ContactBeginTouchEvent& evt = events.beginEvents[i];
+                queue_collision(body_user_entity(b2Body_GetUserData(b2Shape_GetBody(evt.shapeIdA))),
+                                body_user_entity(b2Body_GetUserData(b2Shape_GetBody(evt.shapeIdB))), true);
+            }
+            for (int i = 0; i < events.endCount; i++) {
+                const b2ContactEndTouchEvent& evt = events.endEvents[i];
+                // A shape destroyed during the step still reports its end event.
+                if (!b2Shape_IsValid(evt.shapeIdA) || !b2Shape_IsValid(evt.shapeIdB))
+                    continue;
+                queue_collision(body_user_entity(b2Body_GetUserData(b2Shape_GetBody(evt.shapeIdA))),
+                                body_user_entity(b2Body_GetUserData(b2Shape_GetBody(evt.shapeIdB))), false);
             }
         }
+
+        // Runs every frame, stepped or not: alpha moves on even when the simulation doesn't.
+        auto blend = [&](entt::entity e) {
+            if (!m_registry.valid(e) || !bodies.contains(e))
+                return;
+
+            Entity entity = { e, this };
+            auto& tc = bodies.get<TransformComponent>(e);
+            auto& rb = bodies.get<Rigidbody2DComponent>(e);
+
+            const glm::vec2 position = glm::mix(rb.previous_position, rb.current_position, alpha);
+            const float turn = std::remainder(rb.current_angle - rb.previous_angle, glm::two_pi<float>());
+            glm::vec3 world_pos(position, tc.translation.z);
+            float world_rot = rb.previous_angle + turn * alpha;
+
+            if (!entity.has_parent()) {
+                // Root Rigidbody: world == local
+                tc.translation = world_pos;
+                tc.rotation.z = world_rot;
+            } else {
+                // Child Rigidbody: convert world → local
+                Entity parent = entity.get_parent();
+                glm::mat4 parent_world = parent.get_world_transform();
+                glm::mat4 inv_parent = glm::inverse(parent_world);
+
+                glm::mat4 world =
+                    glm::translate(glm::mat4(1.0f), world_pos) *
+                    glm::rotate(glm::mat4(1.0f), world_rot, {0,0,1});
+
+                glm::mat4 local = inv_parent * world;
+
+                Math::decompose_transform(
+                    local,
+                    tc.translation,
+                    tc.rotation,
+                    tc.scale
+                );
+            }
+            mark_transform_dirty(e);
+        };
+
+        for (auto e : m_settled_bodies_2d)
+            blend(e);
+        for (auto e : m_moving_bodies_2d)
+            blend(e);
+        m_settled_bodies_2d.clear();
     }
 
-    void Scene::on_update_physics_3d(Timestep ts) {
+    void Scene::on_update_physics_3d(Timestep ts, float step, uint32_t max_steps) {
         auto& settings = Settings::get().physics;
-        if (!settings.enabled) return;
-
         auto& engine = PhysicsEngine3D::get();
 
+        // Finish the step started at the end of the previous update, if any. Rendering and this
+        // frame's scripts ran while it was in flight; body commands they queued are applied now.
+        const bool ran_ahead = engine.take_async_step();
+
         // Push editor-moved transforms into Jolt
         auto view = m_registry.view<RigidbodyComponent, TransformComponent>();
         for (auto e : view) {
@@ -904,14 +1225,57 @@ namespace Honey {
             tc.dirty = false;
         }
 
-        engine.step(ts);
+        // Only bodies that were active in a step touch the ECS (sleeping ones are skipped). Bodies
+        // that moved in the step before but not in this one get a last write, then drop out.
+        auto store_moved_poses = [&]() {
+            for (auto e : m_moving_bodies_3d) {
+                if (auto* rb = m_registry.try_get<RigidbodyComponent>(e)) {
+                    rb->previous_position = rb->current_position;
+                    rb->previous_rotation = rb->current_rotation;
+                    m_settled_bodies_3d.push_back(e);
+                }
+            }
+            m_moving_bodies_3d.clear();
 
-        // Pull Jolt transforms back into ECS
-        for (auto e : view) {
-            auto& rb = view.get<RigidbodyComponent>(e);
-            if (rb.body_type == RigidbodyComponent::BodyType::Static) continue;
-            if (rb.runtime_body_id == 0xFFFFFFFF) continue;
-            engine.sync_body_to_transform(Entity{e, this});
+            engine.collect_moved_bodies(m_moved_body_ids);
+            for (UUID id : m_moved_body_ids) {
+                Entity entity = get_entity(id);
+                if (!entity || !entity.has_component<RigidbodyComponent>())
+                    continue;
+                engine.store_body_pose(entity);
+                m_moving_bodies_3d.push_back(entity);
+            }
+        };
+
+        if (ran_ahead)
+            store_moved_poses();
+
+        // Usually nothing is due here: the step run ahead already covers this frame.
+        const uint32_t steps = m_physics_3d_clock.advance(ts, step, max_steps);
+        for (uint32_t n = 0; n < steps; ++n) {
+            engine.step(step);
+            store_moved_poses();
+        }
+
+        engine.dispatch_contact_events();
+
+        // Pull the blended poses back into ECS, every frame
+        const float alpha = settings.interpolate ? m_physics_3d_clock.alpha() : 1.0f;
+        auto blend = [&](entt::entity e) {
+            if (m_registry.valid(e) && m_registry.all_of<RigidbodyComponent>(e))
+                engine.sync_body_to_transform({ e, this }, alpha);
+        };
+        for (auto e : m_settled_bodies_3d)
+            blend(e);
+        for (auto e : m_moving_bodies_3d)
+            blend(e);
+        m_settled_bodies_3d.clear();
+
+        // Start the step the next frame will need now, so it overlaps with rendering and the
+        // next script update instead of running between them.
+        if (settings.async_step_3d && m_physics_3d_clock.next_step_due(ts)) {
+            m_physics_3d_clock.run_ahead();
+            engine.step_async(step);
         }
     }
 
@@ -919,7 +1283,8 @@ namespace Honey {
                                  uint32_t viewport_w, uint32_t viewport_h, float camera_exposure) {
         HN_PROFILE_FUNCTION();
 
-        bool parallel_mesh_submit_enabled = Settings::get().renderer.enable_parallel_mesh_submission;
+        const auto& renderer_settings = Settings::get().renderer;
+        bool parallel_mesh_submit_enabled = renderer_settings.enable_parallel_mesh_submission;
 #if HN_RENDERER_2D_ENABLED
         {
             HN_PROFILE_SCOPE("Render2DScene");
@@ -982,7 +1347,7 @@ namespace Honey {
                 dir_shadows_enabled = dl.shadows;
                 break;
             }
-            Renderer3D::set_directional_shadow_enabled(dir_shadows_enabled, Settings::get().renderer.dir_shadow_distance);
+            Renderer3D::set_directional_shadow_enabled(dir_shadows_enabled, renderer_settings.dir_shadow_distance);
 
             auto point_light_group = m_registry.group<PointLightComponent>(entt::get<TransformComponent>);
             for (auto entity : point_light_group) {
@@ -1116,11 +1481,55 @@ namespace Honey {
             Renderer3D::submit_tiled_lighting_data(tiled_data);
             Renderer3D::begin_scene(view_proj, camera_pos, view, projection, camera_exposure);
 
+            MeshCullContext& cull = *m_mesh_cull;
+            cull.enabled = renderer_settings.enable_cpu_frustum_culling;
+            if (cull.enabled) {
+                HN_PROFILE_SCOPE("Render3DScene::BuildCullContext");
+                cull.camera = Math::Frustum::from_view_projection(view_proj);
+
+                cull.directional_shadows = dir_shadows_enabled;
+                if (dir_shadows_enabled) {
+                    const glm::vec3 forward = -glm::vec3(view[0][2], view[1][2], view[2][2]);
+                    cull.shadow_receivers = cull.camera;
+                    cull.shadow_receivers.planes[Math::Frustum::Far] = glm::vec4(
+                        -forward, glm::dot(forward, camera_pos) + renderer_settings.dir_shadow_distance);
+                    cull.light_direction = lights_ubo.directional_light.direction;
+                }
+
+                cull.shadow_spheres.clear();
+                for (int i = 0; i < lights_ubo.directional_light.point_light_count; ++i) {
+                    const auto& pl = lights_ubo.point_lights[i];
+                    if (pl.intensity > 0.0f && cull.camera.intersects_sphere(pl.position, pl.range))
+                        cull.shadow_spheres.emplace_back(pl.position, pl.range);
+                }
+            }
+
+            // Candidate instances: whatever the spatial tree returns for the cull volumes when
+            // culling, every mesh otherwise. Submeshes are then tested individually below.
+            m_mesh_candidates.clear();
+            auto mesh_view = m_registry.view<TransformComponent, MeshRendererComponent>();
+            if (cull.enabled) {
+                HN_PROFILE_SCOPE("Render3DScene::SpatialQuery");
+                m_spatial_tree.query(
+                    [&](const Math::AABB& box) { return cull_accepts(cull, box); },
+                    [&](entt::entity e) {
+                        if (mesh_view.contains(e))
+                            m_mesh_candidates.push_back(e);
+                        return true;
+                    });
+                const size_t mesh_count = m_registry.storage<MeshRendererComponent>().size();
+                Renderer3D::record_culled_instances((uint32_t)(mesh_count - m_mesh_candidates.size()));
+            } else {
+                for (auto e : mesh_view)
+                    m_mesh_candidates.push_back(e);
+            }
+
             if (!parallel_mesh_submit_enabled) {
                 HN_PROFILE_SCOPE("Render3DScene::MeshSubmissionLoop"); // This loop is INCREDIBLY slow when application is built in debug mode
-                auto mesh_view = m_registry.view<TransformComponent, MeshRendererComponent>();
-
-                for (auto [entity, tc, mr] : mesh_view.each()) {
+                uint32_t culled = 0;
+                for (auto entity : m_mesh_candidates) {
+                    const auto& tc = mesh_view.get<TransformComponent>(entity);
+                    const auto& mr = mesh_view.get<MeshRendererComponent>(entity);
 
                     if (!mr.mesh)
                         continue;
@@ -1134,11 +1543,19 @@ namespace Honey {
                         const Ref<Material>& material =
                             (i < overrides.size() && overrides[i]) ? overrides[i] : sm.material;
 
-                        Renderer3D::submit_submesh(sm, material, world * sm.transform, (int)entity, mr.mesh.get());
+                        const glm::mat4 transform = world * sm.transform;
+                        if (!is_submesh_visible(cull, sm, transform)) {
+                            ++culled;
+                            continue;
+                        }
+
+                        Renderer3D::submit_submesh(sm, material, transform, (int)entity, mr.mesh.get());
                     }
                 }
+                Renderer3D::record_culled_submissions(culled);
             } else {
-                HN_CORE_WARN("Parallel mesh submission is not yet implemented! No meshes will be drawn.");
+                HN_PROFILE_SCOPE("Render3DScene::ParallelMeshSubmission");
+                submit_meshes_parallel(m_registry, m_mesh_candidates, cull, *m_mesh_submit_scratch);
             }
 
             Renderer3D::end_scene();
@@ -1148,17 +1565,24 @@ namespace Honey {
         m_cloth_system->on_render(m_registry, view_proj);
     }
 
+    // Levels narrower than this are updated serially.
+    static constexpr uint32_t k_parallel_transform_level_min = 4096;
+    static constexpr uint32_t k_parallel_transform_batch     = 512;
+    // Tombstones tolerated before the order is compacted by a full rebuild.
+    static constexpr uint32_t k_transform_order_min_holes    = 1024;
+
     void Scene::rebuild_transform_order() {
         HN_PROFILE_FUNCTION();
-        m_transform_order.clear();
+        m_transform_levels.clear();
+        m_transform_order_holes = 0;
 
         auto all = m_registry.view<TransformComponent>();
-        m_transform_order.reserve(all.size());
 
-        // Map entity → index in m_transform_order, filled as we BFS.
-        // Used to resolve parent_idx at insertion time.
-        std::unordered_map<entt::entity, int32_t> entity_to_idx;
-        entity_to_idx.reserve(all.size());
+        // Map entity → slot in m_transform_levels, filled as we BFS.
+        // Used to resolve parent_idx at insertion time, and kept for incremental edits.
+        auto& entity_to_slot = m_transform_order_index;
+        entity_to_slot.clear();
+        entity_to_slot.reserve(all.size());
 
         // BFS from all roots so parents always precede their children.
         std::queue<entt::entity> queue;
@@ -1176,20 +1600,25 @@ namespace Honey {
         while (!queue.empty()) {
             entt::entity e = queue.front(); queue.pop();
 
-            // Resolve parent index — parent was already inserted (BFS guarantee)
-            int32_t parent_idx = -1;
+            // Resolve parent slot — parent was already inserted (BFS guarantee)
+            uint32_t level      = 0;
+            int32_t  parent_idx = -1;
             if (m_registry.all_of<RelationshipComponent>(e)) {
                 const auto& rel = m_registry.get<RelationshipComponent>(e);
                 if (rel.parent != entt::null && m_registry.valid(rel.parent)) {
-                    auto pit = entity_to_idx.find(rel.parent);
-                    if (pit != entity_to_idx.end())
-                        parent_idx = pit->second;
+                    auto pit = entity_to_slot.find(rel.parent);
+                    if (pit != entity_to_slot.end()) {
+                        level      = pit->second.level + 1;
+                        parent_idx = (int32_t)pit->second.index;
+                    }
                 }
             }
 
-            const int32_t my_idx = (int32_t)m_transform_order.size();
-            entity_to_idx[e] = my_idx;
-            m_transform_order.push_back({e, parent_idx});
+            if (level == m_transform_levels.size())
+                m_transform_levels.emplace_back();
+            auto& entries = m_transform_levels[level];
+            entity_to_slot[e] = { level, (uint32_t)entries.size() };
+            entries.push_back({e, parent_idx});
 
             if (m_registry.all_of<RelationshipComponent>(e)) {
                 const auto& rel = m_registry.get<RelationshipComponent>(e);
@@ -1199,41 +1628,383 @@ namespace Honey {
                 }
             }
         }
+
+        m_transform_order_valid = true;
+    }
+
+    void Scene::transform_order_insert_root(entt::entity entity) {
+        if (!m_transform_order_valid)
+            return;
+
+        if (m_transform_levels.empty())
+            m_transform_levels.emplace_back();
+        auto& roots = m_transform_levels[0];
+        m_transform_order_index[entity] = { 0, (uint32_t)roots.size() };
+        roots.push_back({entity, -1});
+
+        // New entities start with a dirty local transform; make sure it gets a world matrix.
+        m_dirty_transform_roots.push_back(entity);
+    }
+
+    void Scene::transform_order_remove(entt::entity entity) {
+        if (!m_transform_order_valid)
+            return;
+
+        auto it = m_transform_order_index.find(entity);
+        if (it == m_transform_order_index.end())
+            return;
+
+        m_transform_levels[it->second.level][it->second.index].entity = entt::null;
+        m_transform_order_index.erase(it);
+        ++m_transform_order_holes;
+
+        const size_t live = m_transform_order_index.size();
+        if (m_transform_order_holes > k_transform_order_min_holes && m_transform_order_holes > live)
+            m_transform_order_valid = false; // compact on the next update
+    }
+
+    void Scene::transform_order_reparent(entt::entity entity) {
+        if (!m_transform_order_valid)
+            return;
+
+        // Re-append the whole subtree (BFS, so each parent gets its new slot before its
+        // children) at the depth implied by the new parent; old slots become tombstones.
+        auto& queue = m_transform_splice_queue;
+        queue.clear();
+        queue.push_back(entity);
+
+        for (size_t head = 0; head < queue.size(); ++head) {
+            const entt::entity e = queue[head];
+            if (!m_registry.all_of<TransformComponent>(e))
+                continue;
+
+            uint32_t level      = 0;
+            int32_t  parent_idx = -1;
+            const auto* rel = m_registry.try_get<RelationshipComponent>(e);
+            if (rel && rel->parent != entt::null && m_registry.valid(rel->parent)) {
+                auto pit = m_transform_order_index.find(rel->parent);
+                if (pit == m_transform_order_index.end()) {
+                    // Parent isn't in the order (shouldn't happen) — fall back to a full rebuild.
+                    m_transform_order_valid = false;
+                    return;
+                }
+                level      = pit->second.level + 1;
+                parent_idx = (int32_t)pit->second.index;
+            }
+
+            transform_order_remove(e);
+            if (!m_transform_order_valid)
+                return;
+
+            if (level >= m_transform_levels.size())
+                m_transform_levels.resize(level + 1);
+            auto& entries = m_transform_levels[level];
+            m_transform_order_index[e] = { level, (uint32_t)entries.size() };
+            entries.push_back({e, parent_idx});
+
+            if (rel) {
+                for (auto child : rel->children) {
+                    if (m_registry.valid(child))
+                        queue.push_back(child);
+                }
+            }
+        }
+
+        m_dirty_transform_roots.push_back(entity);
+    }
+
+    void Scene::mark_transform_dirty(entt::entity entity) {
+        auto* tc = m_registry.try_get<TransformComponent>(entity);
+        if (!tc)
+            return;
+
+        tc->dirty = true;
+        m_dirty_transform_roots.push_back(entity);
+    }
+
+    TransformComponent* Scene::lease_transform(entt::entity entity) {
+        auto* tc = m_registry.try_get<TransformComponent>(entity);
+        if (tc)
+            m_leased_transforms.push_back(entity);
+        return tc;
+    }
+
+    void Scene::destroy_entity_deferred(entt::entity entity) {
+        m_deferred_destroys.push_back(entity);
+    }
+
+    void Scene::flush_script_writes() {
+        if (m_leased_transforms.empty() && m_deferred_destroys.empty())
+            return;
+
+        HN_PROFILE_FUNCTION();
+
+        for (auto e : m_leased_transforms) {
+            if (!m_registry.valid(e))
+                continue;
+            auto& tc = m_registry.get<TransformComponent>(e);
+            if (tc.dirty) {
+                // Which field changed is unknown, so colliders are rebuilt as for a scale change.
+                tc.collider_dirty = true;
+                m_dirty_transform_roots.push_back(e);
+            }
+        }
+        m_leased_transforms.clear();
+
+        // Swap the queue out first: destroying an entity can run script callbacks that queue more.
+        std::vector<entt::entity> destroys;
+        destroys.swap(m_deferred_destroys);
+        for (auto e : destroys) {
+            if (m_registry.valid(e))
+                destroy_entity({ e, this });
+        }
     }
 
     void Scene::update_world_transforms() {
         HN_PROFILE_FUNCTION();
 
-        // Rebuild the sorted order only when the hierarchy changes.
-        if (m_transform_order_version != m_change_version) {
+        flush_script_writes();
+
+        // Full rebuild + full pass only on first use or after compaction; day-to-day
+        // hierarchy edits are spliced in and only the marked subtrees are touched.
+        if (!m_transform_order_valid) {
             rebuild_transform_order();
-            m_transform_order_version = m_change_version;
+            update_world_transforms_full();
+        } else {
+            update_dirty_transform_subtrees();
         }
 
-        // Single linear pass — parents are always processed before children.
-        // parent_idx was cached at rebuild time so we never touch RelationshipComponent here.
-        // world_dirty propagates downward: a dirty parent forces all children to recompute.
-        for (const auto& entry : m_transform_order) {
-            HN_CORE_ASSERT(m_registry.valid(entry.entity), "Stale entity in transform order — hierarchy changed without mark_dirty()");
+        update_spatial_index();
+    }
 
-            auto& tc = m_registry.get<TransformComponent>(entry.entity);
+    namespace {
+        // Half-size of the box used for meshes without import bounds, so they are never culled.
+        constexpr float k_unbounded_extent = 1.0e6f;
+
+        Math::AABB compute_world_bounds(const TransformComponent& tc, const MeshRendererComponent* mr) {
+            if (mr && mr->mesh) {
+                const Math::AABB& local = mr->mesh->get_bounds();
+                if (local.is_valid())
+                    return local.transformed(tc.world);
+                return { glm::vec3(-k_unbounded_extent), glm::vec3(k_unbounded_extent) };
+            }
 
-            bool      parent_world_dirty = false;
-            glm::mat4 parent_world(1.0f);
+            const glm::vec3 position(tc.world[3]);
+            return { position, position };
+        }
+    }
+
+    void Scene::update_spatial_index() {
+        HN_PROFILE_FUNCTION();
+
+        auto transforms = m_registry.view<TransformComponent>();
+        auto refresh = [&](entt::entity e) {
+            const auto& tc = transforms.get<TransformComponent>(e);
+            const Math::AABB bounds = compute_world_bounds(tc, m_registry.try_get<MeshRendererComponent>(e));
+
+            const auto index = (size_t)entt::to_entity(e);
+            if (index >= m_spatial_proxies.size())
+                m_spatial_proxies.resize(index + 1, DynamicAABBTree::k_null_node);
+
+            int32_t& proxy = m_spatial_proxies[index];
+            if (proxy == DynamicAABBTree::k_null_node)
+                proxy = m_spatial_tree.create_proxy(bounds, e);
+            else
+                m_spatial_tree.move_proxy(proxy, bounds);
+        };
+
+        // Same "what moved" set the transform update just produced. After a full pass also
+        // pick up entities that never got a proxy (e.g. copied scenes, whose transforms
+        // arrive with a clean world matrix).
+        if (m_world_dirty_everywhere) {
+            for (auto e : transforms) {
+                const auto index = (size_t)entt::to_entity(e);
+                const bool has_proxy = index < m_spatial_proxies.size() &&
+                                       m_spatial_proxies[index] != DynamicAABBTree::k_null_node;
+                if (!has_proxy || transforms.get<TransformComponent>(e).world_dirty)
+                    refresh(e);
+            }
+        } else {
+            for (auto e : m_world_dirty_entities)
+                refresh(e);
+        }
+
+        // Mesh renderers added or given a new mesh without a transform change (editor panels,
+        // scripts, finished streams) would otherwise keep a point-sized or stale proxy.
+        for (auto e : m_spatial_refresh) {
+            if (m_registry.valid(e) && transforms.contains(e))
+                refresh(e);
+        }
+        m_spatial_refresh.clear();
+    }
+
+    void Scene::spatial_index_remove(entt::entity entity) {
+        const auto index = (size_t)entt::to_entity(entity);
+        if (index >= m_spatial_proxies.size() || m_spatial_proxies[index] == DynamicAABBTree::k_null_node)
+            return;
+
+        m_spatial_tree.destroy_proxy(m_spatial_proxies[index]);
+        m_spatial_proxies[index] = DynamicAABBTree::k_null_node;
+    }
+
+    Entity Scene::raycast_bounds(const glm::vec3& origin, const glm::vec3& direction, float max_distance, float* out_distance) {
+        HN_PROFILE_FUNCTION();
+
+        entt::entity closest = entt::null;
+        float closest_t = max_distance;
+        m_spatial_tree.raycast(origin, direction, max_distance, [&](entt::entity e, float t) {
+            if (t < closest_t || closest == entt::null) {
+                closest   = e;
+                closest_t = t;
+            }
+            return t;
+        });
+
+        if (closest == entt::null)
+            return {};
+        if (out_distance)
+            *out_distance = closest_t;
+        return { closest, this };
+    }
+
+    void Scene::update_dirty_transform_subtrees() {
+        HN_PROFILE_FUNCTION();
+
+        auto transforms = m_registry.view<TransformComponent>();
+
+        // world_dirty means "world changed during the last update", so lower last frame's flags first.
+        if (m_world_dirty_everywhere) {
+            for (auto e : transforms)
+                transforms.get<TransformComponent>(e).world_dirty = false;
+            m_world_dirty_everywhere = false;
+        } else {
+            for (auto e : m_world_dirty_entities) {
+                if (m_registry.valid(e))
+                    transforms.get<TransformComponent>(e).world_dirty = false;
+            }
+        }
+        m_world_dirty_entities.clear();
+
+        // Code that edits a transform and only raises `dirty` (editor gizmos and panels, native
+        // scripts) is still picked up: one pass over the flags, without touching matrices.
+        // Entities that were queued as well are deduplicated below.
+        transforms.each([this](entt::entity e, const TransformComponent& tc) {
+            if (tc.dirty)
+                m_dirty_transform_roots.push_back(e);
+        });
+
+        if (m_dirty_transform_roots.empty())
+            return;
+
+        // Parents first (by level), so a root nested under another dirty root is
+        // already covered by the time we reach it and can be skipped.
+        auto& roots = m_dirty_transform_roots;
+        std::erase_if(roots, [this](entt::entity e) {
+            return !m_registry.valid(e) || !m_transform_order_index.contains(e);
+        });
+        std::sort(roots.begin(), roots.end(), [this](entt::entity a, entt::entity b) {
+            const auto& sa = m_transform_order_index.at(a);
+            const auto& sb = m_transform_order_index.at(b);
+            return sa.level != sb.level ? sa.level < sb.level : sa.index < sb.index;
+        });
+        roots.erase(std::unique(roots.begin(), roots.end()), roots.end());
+
+        auto& stack = m_transform_walk_stack;
+        for (entt::entity root : roots) {
+            if (transforms.get<TransformComponent>(root).world_dirty)
+                continue;
 
-            if (entry.parent_idx >= 0) {
-                const auto& ptc = m_registry.get<TransformComponent>(m_transform_order[entry.parent_idx].entity);
-                parent_world       = ptc.world;
-                parent_world_dirty = ptc.world_dirty;
+            glm::mat4 parent_world(1.0f);
+            const auto& slot = m_transform_order_index.at(root);
+            const int32_t parent_idx = m_transform_levels[slot.level][slot.index].parent_idx;
+            if (parent_idx >= 0) {
+                const entt::entity parent = m_transform_levels[slot.level - 1][parent_idx].entity;
+                parent_world = transforms.get<TransformComponent>(parent).world;
             }
 
-            if (tc.dirty || parent_world_dirty) {
-                tc.world       = parent_world * tc.get_transform(); // clears tc.dirty
+            stack.clear();
+            stack.emplace_back(root, parent_world);
+            while (!stack.empty()) {
+                auto [e, world] = stack.back();
+                stack.pop_back();
+
+                auto& tc = transforms.get<TransformComponent>(e);
+                tc.world       = world * tc.get_transform(); // clears tc.dirty
                 tc.world_dirty = true;
-            } else {
-                tc.world_dirty = false;
+                m_world_dirty_entities.push_back(e);
+
+                if (const auto* rel = m_registry.try_get<RelationshipComponent>(e)) {
+                    for (auto child : rel->children) {
+                        if (m_registry.valid(child) && transforms.contains(child))
+                            stack.emplace_back(child, tc.world);
+                    }
+                }
             }
         }
+
+        roots.clear();
+    }
+
+    void Scene::update_world_transforms_full() {
+        HN_PROFILE_FUNCTION();
+
+        // Resolve the storage once; workers then only do pool lookups, never registry bookkeeping.
+        auto transforms = m_registry.view<TransformComponent>();
+
+        // One level at a time: every parent sits in an earlier level and is already
+        // final, and entries in the same level only write their own component.
+        // Narrow levels stay on this thread; fork/join would cost more than the work.
+        for (size_t level = 0; level < m_transform_levels.size(); ++level) {
+            const auto& entries = m_transform_levels[level];
+            const auto* parents = level > 0 ? &m_transform_levels[level - 1] : nullptr;
+
+            // world_dirty propagates downward: a dirty parent forces all children to recompute.
+            auto update_entry = [&](uint32_t i) {
+                const auto& entry = entries[i];
+                if (entry.entity == entt::null)
+                    return; // tombstone
+
+                HN_CORE_ASSERT(m_registry.valid(entry.entity), "Stale entity in transform order — entity destroyed without going through Scene");
+
+                auto& tc = transforms.get<TransformComponent>(entry.entity);
+
+                bool      parent_world_dirty = false;
+                glm::mat4 parent_world(1.0f);
+
+                if (entry.parent_idx >= 0) {
+                    const entt::entity parent = (*parents)[entry.parent_idx].entity;
+                    HN_CORE_ASSERT(parent != entt::null, "Transform order entry points at a removed parent");
+                    const auto& ptc = transforms.get<TransformComponent>(parent);
+                    parent_world       = ptc.world;
+                    parent_world_dirty = ptc.world_dirty;
+                }
+
+                if (tc.dirty || parent_world_dirty) {
+                    tc.world       = parent_world * tc.get_transform(); // clears tc.dirty
+                    tc.world_dirty = true;
+                } else {
+                    tc.world_dirty = false;
+                }
+            };
+
+            const uint32_t count = (uint32_t)entries.size();
+            if (count >= k_parallel_transform_level_min) {
+                TaskHandle handle = TaskSystem::parallel_for(0, count, update_entry, k_parallel_transform_batch,
+                                                             TaskLane::frame_critical);
+                if (handle) {
+                    TaskSystem::wait(handle);
+                    continue;
+                }
+            }
+
+            for (uint32_t i = 0; i < count; ++i)
+                update_entry(i);
+        }
+
+        // Everything queued so far has been covered by this pass.
+        m_dirty_transform_roots.clear();
+        m_world_dirty_entities.clear();
+        m_world_dirty_everywhere = true;
     }
 
     void Scene::update_streamed_assets() {
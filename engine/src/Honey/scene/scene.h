@@ -8,12 +8,18 @@
 #include "Honey/core/uuid.h"
 #include "Honey/renderer/editor_camera.h"
 #include "Honey/core/log.h"
+#include "Honey/scene/dynamic_aabb_tree.h"
+#include "Honey/scene/system_scheduler.h"
+#include "Honey/physics/fixed_timestep.h"
 #include <box2d/id.h>
 
 namespace Honey {
 
     class ClothSystem;
     class Entity;
+    struct MeshCullContext;
+    struct ParallelMeshSubmitScratch;
+    struct TransformComponent;
     class Scene {
 
     public:
@@ -51,7 +57,12 @@ namespace Honey {
         static Scene* get_active_scene() { return s_active_scene; }
         static void set_active_scene(Scene* scene) { s_active_scene = scene; }
 
+        // Play-mode snapshot. The copy keeps the source's entity ids, so component storages are
+        // copied wholesale and the cached transform order and spatial index carry over as-is.
         static Ref<Scene> copy(Ref<Scene> source);
+        // Puts this scene back into the state held by `snapshot` (typically a copy taken before
+        // Play), discarding every entity and component it has now. Stop the runtime first.
+        void restore(const Scene& snapshot);
 
         void duplicate_entity(Entity entity);
 
@@ -88,6 +99,42 @@ namespace Honey {
             m_scene_state.clear();
         }
 
+        // Queues an entity whose TransformComponent translation/rotation/scale changed.
+        // update_world_transforms only walks the subtrees under queued entities, plus any entity
+        // whose `dirty` flag was raised directly.
+        void mark_transform_dirty(entt::entity entity);
+
+        // Direct TransformComponent access for managed scripts. The entity is remembered, and if
+        // its `dirty` flag is raised when the scene next flushes script writes (after the script
+        // update, and again before the transform update), it is queued as if
+        // mark_transform_dirty had been called. Returns null for entities without a transform.
+        //
+        // The pointer stays valid until that flush: destruction requested by scripts goes through
+        // destroy_entity_deferred, so component storage cannot be compacted underneath it.
+        TransformComponent* lease_transform(entt::entity entity);
+        void destroy_entity_deferred(entt::entity entity);
+
+        // Queues a spatial index refresh for an entity whose MeshRendererComponent::mesh was
+        // assigned in place. Adding or replacing the component queues one already.
+        void mark_bounds_dirty(entt::entity entity);
+
+        // Bounding-volume tree over entity world bounds (the mesh bounds, or just the world
+        // position for entities without a mesh). Refreshed at the end of
+        // update_world_transforms, so queries see the scene as of the last update.
+        const DynamicAABBTree& get_spatial_tree() const { return m_spatial_tree; }
+
+        // Nearest entity whose world bounds the ray enters within max_distance, or an invalid Entity.
+        Entity raycast_bounds(const glm::vec3& origin, const glm::vec3& direction, float max_distance,
+                              float* out_distance = nullptr);
+
+        // Queues OnCollisionBegin/End for both sides of a contact, for scripts that override them.
+        // Either entity may already be gone. The physics update delivers the queue to C# in one
+        // batch once all of its steps have run.
+        void queue_collision(entt::entity a, entt::entity b, bool begin);
+
+        // Stage timings of the last runtime/simulation update.
+        const SystemScheduler& get_update_stages() const { return m_update_stages; }
+
         void mark_dirty() { ++m_change_version; }
         void clear_dirty() { m_change_version = 0; }
         uint64_t get_change_version() const { return m_change_version; }
@@ -96,37 +143,128 @@ namespace Honey {
     private:
 
         Entity duplicate_entity_recursive(Entity source, Entity new_parent, bool is_root);
+        // Tears down what the registry's components hold outside it, before copy_from drops the
+        // registry. The runtime must already be stopped.
+        void release_runtime_resources();
+        void copy_from(const Scene& source);
+        void build_update_stages();
+        void run_update_stages(Timestep ts, bool paused);
 
         void on_update_scripts(Timestep ts);
         void on_update_audio(Timestep ts);
-        void on_update_physics_2d(Timestep ts);
-        void on_update_physics_3d(Timestep ts);
+        // Runs the fixed physics steps due this frame, then blends render poses by the leftover time.
+        // Collisions are only queued; flush_collision_events delivers them.
+        void on_update_physics(Timestep ts);
+        void on_update_physics_2d(uint32_t steps, float step, float alpha);
+        void on_update_physics_3d(Timestep ts, float step, uint32_t max_steps);
         void on_update_render(const glm::mat4& view, const glm::mat4& projection, const glm::mat4& view_proj, const glm::vec3& camera_pos,
                               uint32_t viewport_w, uint32_t viewport_h, float camera_exposure = 1.0f);
+        void flush_script_writes();
+        void flush_collision_events();
         void update_world_transforms();
+        void update_world_transforms_full();
+        void update_dirty_transform_subtrees();
 
         void update_streamed_assets();
         void rebuild_transform_order();
 
+        // Incremental transform order maintenance; no-ops while a full rebuild is pending.
+        void transform_order_insert_root(entt::entity entity);
+        void transform_order_remove(entt::entity entity);
+        void transform_order_reparent(entt::entity entity);
+
+        void update_spatial_index();
+        void spatial_index_remove(entt::entity entity);
+
+        // Hooks the registry's MeshRendererComponent construct/update signals; again after the
+        // registry is replaced.
+        void connect_registry_signals();
+        void on_mesh_renderer_changed(entt::registry& registry, entt::entity entity);
+
         static Scene* s_active_scene;
         entt::registry m_registry;
+
+        // UUID -> entity index. Kept in sync by create_entity/destroy_entity
+        // (and Entity::destroy) so get_entity never has to walk IDComponent.
+        std::unordered_map<UUID, entt::entity> m_entity_map;
         std::unordered_map<std::string, SceneValue> m_scene_state;
 
-        // Flat BFS-sorted list of all entities with TransformComponent.
-        // Parents are always before their children, so world transforms
-        // can be computed in one linear pass without recursion.
-        // parent_idx is the index of this entity's parent in the same vector (-1 = root).
+        // All entities with TransformComponent, bucketed by hierarchy depth.
+        // Every parent lives in an earlier level than its children, so world
+        // transforms can be computed level by level (each level in parallel)
+        // without recursion. parent_idx indexes the previous level (-1 = root).
         // Cached so the hot update loop never touches RelationshipComponent.
+        //
+        // Maintained incrementally: new entities are appended to level 0, reparented
+        // subtrees are re-appended at their new depth and removed/moved entries leave
+        // a tombstone (entity == entt::null). Tombstones are compacted away by a full
+        // rebuild once they outnumber the live entries.
         struct TransformOrderEntry {
             entt::entity entity;
-            int32_t      parent_idx; // index into m_transform_order, -1 for roots
+            int32_t      parent_idx; // index into the previous level, -1 for roots
+        };
+        struct TransformOrderSlot {
+            uint32_t level;
+            uint32_t index;
         };
-        std::vector<TransformOrderEntry> m_transform_order;
-        uint64_t m_transform_order_version = UINT64_MAX;
+        std::vector<std::vector<TransformOrderEntry>> m_transform_levels;
+        std::unordered_map<entt::entity, TransformOrderSlot> m_transform_order_index;
+        uint32_t m_transform_order_holes = 0;
+        bool     m_transform_order_valid = false;
+
+        // Filled by mark_transform_dirty, drained by update_world_transforms.
+        std::vector<entt::entity> m_dirty_transform_roots;
+        // Entities whose world_dirty was raised by the last update; lowered again by the next one.
+        std::vector<entt::entity> m_world_dirty_entities;
+        // Set after a full pass, which may leave world_dirty raised anywhere.
+        bool m_world_dirty_everywhere = true;
+        std::vector<std::pair<entt::entity, glm::mat4>> m_transform_walk_stack;
+        std::vector<entt::entity> m_transform_splice_queue;
+
+        DynamicAABBTree m_spatial_tree;
+        // Proxy per entity, indexed by entt::to_entity (k_null_node if none).
+        std::vector<int32_t> m_spatial_proxies;
+        // Entities whose mesh may have changed without their transform moving; their proxies are
+        // refreshed by the next update_spatial_index.
+        std::vector<entt::entity> m_spatial_refresh;
+
+        // Scratch for on_update_scripts, kept to avoid per-frame allocations.
+        std::vector<entt::entity> m_script_entities;
+        std::vector<intptr_t> m_script_handles;
+        // Handed out by lease_transform / queued by destroy_entity_deferred since the last flush_script_writes.
+        std::vector<entt::entity> m_leased_transforms;
+        std::vector<entt::entity> m_deferred_destroys;
+        // Filled by queue_collision, drained by flush_collision_events.
+        std::vector<intptr_t> m_collision_handles;
+        std::vector<uint64_t> m_collision_other_ids;
+        std::vector<uint8_t>  m_collision_begins;
 
         b2WorldId m_world = b2_nullWorldId;
+        FixedTimestep m_physics_2d_clock;
+        FixedTimestep m_physics_3d_clock;
+        // Bodies that moved in the last physics step, whose render pose is still being blended,
+        // and bodies that stopped moving during this frame's steps (written once more, at rest).
+        std::vector<entt::entity> m_moving_bodies_2d;
+        std::vector<entt::entity> m_settled_bodies_2d;
+        std::vector<entt::entity> m_moving_bodies_3d;
+        std::vector<entt::entity> m_settled_bodies_3d;
+        std::vector<UUID> m_moved_body_ids;
         std::unique_ptr<ClothSystem> m_cloth_system;
 
+        // Scratch for on_update_render's culling and parallel mesh submission, kept per scene so
+        // viewports of different scenes never share it.
+        std::unique_ptr<MeshCullContext> m_mesh_cull;
+        std::vector<entt::entity> m_mesh_candidates;
+        std::unique_ptr<ParallelMeshSubmitScratch> m_mesh_submit_scratch;
+
+        // Runtime/simulation update: scripts, audio, physics, collision events, streamed assets
+        // and transforms. Stages whose declared components and resources are disjoint share a wave.
+        SystemScheduler m_update_stages{ m_registry };
+        SystemScheduler::StageID m_scripts_stage = 0;
+        SystemScheduler::StageID m_audio_stage = 0;
+        SystemScheduler::StageID m_physics_stage = 0;
+        SystemScheduler::StageID m_collision_stage = 0;
+
         //Entity entity_from_body(b2BodyId body);
 
         uint64_t m_change_version = 0;
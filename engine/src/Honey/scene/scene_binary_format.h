@@ -0,0 +1,334 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Honey::SceneBinary {
+
+    // On-disk layout of SceneSerializer::serialize_runtime.
+    //
+    //   Header
+    //   Section[section_count]          one per component type present
+    //   uint64_t uuids[entity_count]    entity index -> UUID
+    //   section records                 each section 16-byte aligned, `count` records of `stride` bytes
+    //   string table                    NUL-terminated strings; offset 0 is the empty string
+    //
+    // Every offset is relative to the start of the file and nothing holds a pointer, so a loader
+    // can map the file and read it in place. Records reference entities by index into the UUID
+    // array and strings (asset paths, names) by StringRef. All fields are little-endian.
+    //
+    // Bump k_version whenever a record layout changes. New component types can be added without a
+    // bump: loaders skip section ids they do not know. A record may also grow at the end, as long
+    // as the writer bumps the section stride; older loaders only read the prefix they understand.
+
+    constexpr uint32_t k_magic   = 0x42534E48; // "HNSB"
+    constexpr uint32_t k_version = 1;
+    constexpr uint32_t k_section_alignment = 16;
+
+    using StringRef = uint32_t;
+    constexpr StringRef k_empty_string = 0;
+
+    constexpr uint32_t k_no_entity = UINT32_MAX;
+
+    enum class ComponentID : uint32_t {
+        Tag = 0,
+        Transform,
+        Relationship,
+        SpriteRenderer,
+        MeshRenderer,
+        CircleRenderer,
+        LineRenderer,
+        TextRenderer,
+        IconRenderer,
+        Camera,
+        NativeScript,
+        Script,
+        ScriptProperty,
+        Rigidbody2D,
+        BoxCollider2D,
+        CircleCollider2D,
+        Rigidbody,
+        BoxCollider3D,
+        SphereCollider3D,
+        CapsuleCollider3D,
+        Cloth,
+        AudioSource,
+        PointLight,
+        DirectionalLight,
+        SpotLight,
+    };
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t entity_count;
+        uint32_t section_count;
+        uint64_t uuid_offset;
+        uint64_t string_table_offset;
+        uint64_t string_table_size;
+        uint64_t reserved;
+    };
+
+    struct Section {
+        ComponentID component_id;
+        uint32_t    count;
+        uint32_t    stride;
+        uint32_t    reserved;
+        uint64_t    offset;
+    };
+
+    // Every record starts with the index of the entity it belongs to.
+
+    struct TagRecord {
+        uint32_t  entity;
+        StringRef tag;
+    };
+
+    // Local TRS; world matrices are rebuilt by the first transform update.
+    struct TransformRecord {
+        uint32_t  entity;
+        glm::vec3 translation;
+        glm::vec3 rotation;
+        glm::vec3 scale;
+    };
+
+    // Written parent by parent in child order, so appending on load reproduces sibling order.
+    struct RelationshipRecord {
+        uint32_t entity;
+        uint32_t parent;
+    };
+
+    struct SpriteRendererRecord {
+        uint32_t  entity;
+        glm::vec4 color;
+        StringRef texture_path;
+        float     pixels_per_unit;
+        glm::vec2 pivot;
+    };
+
+    struct MeshRendererRecord {
+        uint32_t  entity;
+        glm::vec4 color;
+        StringRef mesh_path;
+        StringRef gltf_source_path;
+        StringRef gltf_node_name;
+    };
+
+    struct CircleRendererRecord {
+        uint32_t  entity;
+        glm::vec4 color;
+        float     thickness;
+        float     fade;
+        StringRef texture_path;
+    };
+
+    struct LineRendererRecord {
+        uint32_t  entity;
+        glm::vec4 color;
+        float     fade;
+        StringRef texture_path;
+    };
+
+    struct TextRendererRecord {
+        uint32_t  entity;
+        StringRef text;
+        StringRef font_path;
+        glm::vec4 color;
+        float     font_size;
+        float     line_spacing;
+    };
+
+    struct IconRendererRecord {
+        uint32_t  entity;
+        StringRef icon_path;
+        glm::vec4 color;
+    };
+
+    struct CameraRecord {
+        uint32_t  entity;
+        uint32_t  projection_type;
+        float     orthographic_size;
+        float     orthographic_near;
+        float     orthographic_far;
+        float     perspective_fov;
+        float     perspective_near;
+        float     perspective_far;
+        float     exposure;
+        // Live camera state, which may have drifted from the projection parameters above.
+        glm::vec3 position;
+        float     aspect_ratio;
+        float     camera_size;      // orthographic
+        float     camera_fov;       // perspective
+        float     ortho_rotation;
+        glm::vec2 persp_rotation;   // yaw, pitch
+        uint8_t   fixed_aspect_ratio;
+        uint8_t   primary;
+        uint8_t   padding[2];
+    };
+
+    struct NativeScriptRecord {
+        uint32_t  entity;
+        StringRef script_name;
+    };
+
+    struct ScriptRecord {
+        uint32_t  entity;
+        StringRef script_name;
+    };
+
+    // One ScriptComponent::property_overrides entry.
+    struct ScriptPropertyRecord {
+        enum class Type : uint32_t { Float = 0, Bool, String };
+
+        uint32_t  entity;
+        StringRef name;
+        Type      type;
+        uint32_t  value; // float bits, 0/1, or a StringRef
+    };
+
+    struct Rigidbody2DRecord {
+        uint32_t entity;
+        uint32_t body_type;
+        uint8_t  fixed_rotation;
+        uint8_t  padding[3];
+    };
+
+    struct BoxCollider2DRecord {
+        uint32_t  entity;
+        glm::vec2 offset;
+        glm::vec2 size;
+        float     density;
+        float     friction;
+        float     restitution;
+    };
+
+    struct CircleCollider2DRecord {
+        uint32_t  entity;
+        glm::vec2 offset;
+        float     radius;
+        float     density;
+        float     friction;
+        float     restitution;
+    };
+
+    struct RigidbodyRecord {
+        uint32_t  entity;
+        uint32_t  body_type;
+        float     mass;
+        float     friction;
+        float     restitution;
+        float     linear_damping;
+        float     angular_damping;
+        glm::vec3 initial_linear_velocity;
+        glm::vec3 initial_angular_velocity;
+        uint8_t   gravity_factor;
+        uint8_t   is_sensor;
+        uint8_t   padding[2];
+    };
+
+    struct BoxCollider3DRecord {
+        uint32_t  entity;
+        glm::vec3 offset;
+        glm::vec3 half_size;
+        float     density;
+        float     friction;
+        float     restitution;
+    };
+
+    struct SphereCollider3DRecord {
+        uint32_t  entity;
+        glm::vec3 offset;
+        float     radius;
+        float     density;
+        float     friction;
+        float     restitution;
+    };
+
+    struct CapsuleCollider3DRecord {
+        uint32_t  entity;
+        glm::vec3 offset;
+        float     radius;
+        float     half_height;
+        float     density;
+        float     friction;
+        float     restitution;
+    };
+
+    struct ClothRecord {
+        uint32_t entity;
+        uint32_t grid_width;
+        uint32_t grid_height;
+        uint32_t substeps;
+    };
+
+    struct AudioSourceRecord {
+        uint32_t  entity;
+        StringRef file_path;
+        float     volume;
+        float     pitch;
+        uint8_t   loop;
+        uint8_t   play_on_scene_start;
+        uint8_t   padding[2];
+    };
+
+    struct PointLightRecord {
+        uint32_t  entity;
+        glm::vec3 color;
+        float     intensity;
+        float     range;
+        uint8_t   enabled;
+        uint8_t   shadows;
+        uint8_t   padding[2];
+    };
+
+    struct DirectionalLightRecord {
+        uint32_t  entity;
+        glm::vec3 color;
+        float     intensity;
+        uint8_t   enabled;
+        uint8_t   shadows;
+        uint8_t   padding[2];
+    };
+
+    struct SpotLightRecord {
+        uint32_t  entity;
+        glm::vec3 color;
+        float     intensity;
+        float     range;
+        float     inner_angle;
+        float     outer_angle;
+        uint8_t   enabled;
+        uint8_t   shadows;
+        uint8_t   padding[2];
+    };
+
+    // The layout is the file format: catch accidental changes at compile time.
+    static_assert(sizeof(Header)                  == 48);
+    static_assert(sizeof(Section)                 == 24);
+    static_assert(sizeof(TagRecord)               == 8);
+    static_assert(sizeof(TransformRecord)         == 40);
+    static_assert(sizeof(RelationshipRecord)      == 8);
+    static_assert(sizeof(SpriteRendererRecord)    == 36);
+    static_assert(sizeof(MeshRendererRecord)      == 32);
+    static_assert(sizeof(CircleRendererRecord)    == 32);
+    static_assert(sizeof(LineRendererRecord)      == 28);
+    static_assert(sizeof(TextRendererRecord)      == 36);
+    static_assert(sizeof(IconRendererRecord)      == 24);
+    static_assert(sizeof(CameraRecord)            == 76);
+    static_assert(sizeof(NativeScriptRecord)      == 8);
+    static_assert(sizeof(ScriptRecord)            == 8);
+    static_assert(sizeof(ScriptPropertyRecord)    == 16);
+    static_assert(sizeof(Rigidbody2DRecord)       == 12);
+    static_assert(sizeof(BoxCollider2DRecord)     == 32);
+    static_assert(sizeof(CircleCollider2DRecord)  == 28);
+    static_assert(sizeof(RigidbodyRecord)         == 56);
+    static_assert(sizeof(BoxCollider3DRecord)     == 40);
+    static_assert(sizeof(SphereCollider3DRecord)  == 32);
+    static_assert(sizeof(CapsuleCollider3DRecord) == 36);
+    static_assert(sizeof(ClothRecord)             == 16);
+    static_assert(sizeof(AudioSourceRecord)       == 20);
+    static_assert(sizeof(PointLightRecord)        == 28);
+    static_assert(sizeof(DirectionalLightRecord)  == 24);
+    static_assert(sizeof(SpotLightRecord)         == 36);
+
+}
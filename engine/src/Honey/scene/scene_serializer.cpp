@@ -3,8 +3,10 @@
 #include "entity.h"
 #include "components.h"
 #include "scriptable_entity.h"
+#include "scene_binary_format.h"
 #include "Honey/math/yaml_glm.h"
 
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <yaml-cpp/yaml.h>
@@ -36,6 +38,58 @@ namespace Honey {
     SceneSerializer::SceneSerializer(const Ref<Scene> &scene, const EditorSceneMeta* meta)
     : m_scene(scene), m_editor_meta(meta) {}
 
+    // Requests the sprite's texture asynchronously; the sprite is (re)built on the main thread
+    // once the texture lands.
+    static void request_sprite_texture(SpriteRendererComponent& sprite, const std::string& texture_path,
+                                       float ppu, glm::vec2 pivot) {
+        sprite.sprite_path = std::filesystem::path(texture_path);
+
+        Ref<Texture2D::AsyncHandle> tex_handle = Texture2D::create_async_manual(texture_path);
+
+        // If texture was already in cache or loaded instantly, this is valid now.
+        if (tex_handle && tex_handle->texture) {
+            sprite.sprite = Sprite::create_from_texture(tex_handle->texture, ppu, pivot);
+        } else {
+            // Optional: create a placeholder sprite if you want something visible
+            // sprite.sprite = Sprite::create_placeholder(ppu, pivot);
+        }
+
+        // Not joined: the handle is dropped, so the task finishes on its own.
+        TaskSystem::run_async(
+            [tex_handle, sprite_ptr = &sprite, ppu, pivot]() {
+                // Wait until backend async completes this handle
+                while (!tex_handle->done.load(std::memory_order_acquire)) {
+                    // Small sleep to avoid a tight busy-wait loop
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+
+                // If it failed, leave whatever fallback we had
+                if (tex_handle->failed.load(std::memory_order_acquire) ||
+                    !tex_handle->texture) {
+                    return;
+                }
+
+                Ref<Texture2D> final_tex = tex_handle->texture;
+
+                // Schedule sprite update on main thread
+                TaskSystem::enqueue_main(
+                    [sprite_ptr, final_tex, ppu, pivot]() {
+                        if (!sprite_ptr)
+                            return;
+
+                        if (!sprite_ptr->sprite) {
+                            // Sprite wasn't created yet; make it now.
+                            sprite_ptr->sprite = Sprite::create_from_texture(
+                                final_tex, ppu, pivot);
+                        } else {
+                            // If Sprite supports changing texture in-place.
+                            sprite_ptr->sprite->set_texture(final_tex);
+                            sprite_ptr->sprite->recalc_size();
+                        }
+                    });
+            });
+    }
+
     static void serialize_entity(Entity entity, YAML::Emitter &out) {
         HN_CORE_ASSERT(entity.has_component<IDComponent>(), "Entity is missing IDComponent!");
 
@@ -509,9 +563,394 @@ namespace Honey {
         HN_CORE_INFO("Serialized prefab to {0}", path.generic_string());
     }
 
+    namespace {
+        // Collects component sections and a deduplicated string table for serialize_runtime.
+        class RuntimeSceneWriter {
+        public:
+            explicit RuntimeSceneWriter(entt::registry& registry) : m_registry(registry) {
+                // Dense entity indices: records refer to entities by position in the UUID table.
+                auto ids = registry.view<IDComponent>();
+                m_uuids.reserve(ids.size());
+                for (auto e : ids) {
+                    const uint32_t slot = entt::to_entity(e);
+                    if (m_entity_index.size() <= slot)
+                        m_entity_index.resize(slot + 1, SceneBinary::k_no_entity);
+                    m_entity_index[slot] = (uint32_t)m_uuids.size();
+                    m_uuids.push_back((uint64_t)ids.get<IDComponent>(e).id);
+                }
+            }
+
+            uint32_t index_of(entt::entity e) const {
+                const uint32_t slot = entt::to_entity(e);
+                return slot < m_entity_index.size() ? m_entity_index[slot] : SceneBinary::k_no_entity;
+            }
+
+            SceneBinary::StringRef intern(const std::string& str) {
+                if (str.empty())
+                    return SceneBinary::k_empty_string;
+
+                auto [it, inserted] = m_string_lookup.try_emplace(str, (SceneBinary::StringRef)m_strings.size());
+                if (inserted)
+                    m_strings.insert(m_strings.end(), str.c_str(), str.c_str() + str.size() + 1);
+                return it->second;
+            }
+
+            // One record per entity holding Component; fill(component, record) sets everything but the entity.
+            template<typename Component, typename Record, typename Fill>
+            void add_section(SceneBinary::ComponentID id, Fill&& fill) {
+                auto view = m_registry.view<Component>();
+                std::vector<Record> records;
+                records.reserve(view.size());
+                for (auto e : view) {
+                    const uint32_t index = index_of(e);
+                    if (index == SceneBinary::k_no_entity)
+                        continue;
+
+                    Record& record = records.emplace_back(); // value-initialised, so padding is zero
+                    record.entity = index;
+                    fill(view.template get<Component>(e), record);
+                }
+                add_section(id, records);
+            }
+
+            template<typename Record>
+            void add_section(SceneBinary::ComponentID id, const std::vector<Record>& records) {
+                static_assert(std::is_trivially_copyable_v<Record>, "Runtime scene records are copied byte-wise");
+                if (records.empty())
+                    return;
+
+                SceneBinary::Section section{};
+                section.component_id = id;
+                section.count  = (uint32_t)records.size();
+                section.stride = (uint32_t)sizeof(Record);
+                m_sections.push_back(section);
+
+                auto& bytes = m_section_bytes.emplace_back(records.size() * sizeof(Record));
+                std::memcpy(bytes.data(), records.data(), bytes.size());
+            }
+
+            std::vector<uint8_t> finish() {
+                using namespace SceneBinary;
+                auto align = [](uint64_t offset, uint64_t alignment) { return (offset + alignment - 1) & ~(alignment - 1); };
+
+                Header header{};
+                header.magic         = k_magic;
+                header.version       = k_version;
+                header.entity_count  = (uint32_t)m_uuids.size();
+                header.section_count = (uint32_t)m_sections.size();
+
+                uint64_t offset = sizeof(Header) + m_sections.size() * sizeof(Section);
+                header.uuid_offset = align(offset, alignof(uint64_t));
+                offset = header.uuid_offset + m_uuids.size() * sizeof(uint64_t);
+                for (size_t i = 0; i < m_sections.size(); ++i) {
+                    m_sections[i].offset = align(offset, k_section_alignment);
+                    offset = m_sections[i].offset + m_section_bytes[i].size();
+                }
+                header.string_table_offset = offset;
+                header.string_table_size   = m_strings.size();
+
+                std::vector<uint8_t> out(header.string_table_offset + header.string_table_size, 0);
+                std::memcpy(out.data(), &header, sizeof(Header));
+                if (!m_sections.empty())
+                    std::memcpy(out.data() + sizeof(Header), m_sections.data(), m_sections.size() * sizeof(Section));
+                if (!m_uuids.empty())
+                    std::memcpy(out.data() + header.uuid_offset, m_uuids.data(), m_uuids.size() * sizeof(uint64_t));
+                for (size_t i = 0; i < m_sections.size(); ++i)
+                    std::memcpy(out.data() + m_sections[i].offset, m_section_bytes[i].data(), m_section_bytes[i].size());
+                std::memcpy(out.data() + header.string_table_offset, m_strings.data(), m_strings.size());
+                return out;
+            }
+
+        private:
+            entt::registry& m_registry;
+            std::vector<uint64_t> m_uuids;
+            std::vector<uint32_t> m_entity_index; // by entt::to_entity
+            std::vector<char> m_strings{ '\0' };
+            std::unordered_map<std::string, SceneBinary::StringRef> m_string_lookup;
+            std::vector<SceneBinary::Section> m_sections;
+            std::vector<std::vector<uint8_t>> m_section_bytes;
+        };
+    }
+
     void SceneSerializer::serialize_runtime(const std::filesystem::path &path) {
-        //not implemented
-        HN_CORE_ASSERT(false, "Not implemented!");
+        HN_PROFILE_FUNCTION();
+        using namespace SceneBinary;
+
+        auto& registry = m_scene->m_registry;
+        RuntimeSceneWriter writer(registry);
+
+        writer.add_section<TagComponent, TagRecord>(ComponentID::Tag, [&](const TagComponent& c, TagRecord& r) {
+            r.tag = writer.intern(c.tag);
+        });
+
+        writer.add_section<TransformComponent, TransformRecord>(ComponentID::Transform, [](const TransformComponent& c, TransformRecord& r) {
+            r.translation = c.translation;
+            r.rotation    = c.rotation;
+            r.scale       = c.scale;
+        });
+
+        {
+            std::vector<RelationshipRecord> records;
+            auto view = registry.view<RelationshipComponent>();
+            for (auto e : view) {
+                const uint32_t parent = writer.index_of(e);
+                if (parent == k_no_entity)
+                    continue;
+                for (entt::entity child : view.get<RelationshipComponent>(e).children) {
+                    const uint32_t index = registry.valid(child) ? writer.index_of(child) : k_no_entity;
+                    if (index != k_no_entity)
+                        records.push_back({ index, parent });
+                }
+            }
+            writer.add_section(ComponentID::Relationship, records);
+        }
+
+        writer.add_section<SpriteRendererComponent, SpriteRendererRecord>(ComponentID::SpriteRenderer,
+            [&](const SpriteRendererComponent& c, SpriteRendererRecord& r) {
+                r.color           = c.color;
+                r.texture_path    = c.sprite ? writer.intern(c.sprite_path.string()) : k_empty_string;
+                r.pixels_per_unit = c.sprite ? c.sprite->get_pixels_per_unit() : 100.0f;
+                r.pivot           = c.sprite ? c.sprite->get_pivot() : glm::vec2(0.5f);
+            });
+
+        writer.add_section<MeshRendererComponent, MeshRendererRecord>(ComponentID::MeshRenderer,
+            [&](const MeshRendererComponent& c, MeshRendererRecord& r) {
+                r.color            = c.color;
+                r.mesh_path        = writer.intern(c.mesh_path.string());
+                r.gltf_source_path = writer.intern(c.gltf_source_path.string());
+                r.gltf_node_name   = writer.intern(c.gltf_node_name);
+            });
+
+        writer.add_section<CircleRendererComponent, CircleRendererRecord>(ComponentID::CircleRenderer,
+            [&](const CircleRendererComponent& c, CircleRendererRecord& r) {
+                r.color        = c.color;
+                r.thickness    = c.thickness;
+                r.fade         = c.fade;
+                r.texture_path = c.texture ? writer.intern(c.texture_path.string()) : k_empty_string;
+            });
+
+        writer.add_section<LineRendererComponent, LineRendererRecord>(ComponentID::LineRenderer,
+            [&](const LineRendererComponent& c, LineRendererRecord& r) {
+                r.color        = c.color;
+                r.fade         = c.fade;
+                r.texture_path = c.texture ? writer.intern(c.texture_path.string()) : k_empty_string;
+            });
+
+        writer.add_section<TextRendererComponent, TextRendererRecord>(ComponentID::TextRenderer,
+            [&](const TextRendererComponent& c, TextRendererRecord& r) {
+                r.text         = writer.intern(c.text);
+                r.font_path    = writer.intern(c.font_path.string());
+                r.color        = c.color;
+                r.font_size    = c.font_size;
+                r.line_spacing = c.line_spacing;
+            });
+
+        writer.add_section<IconRendererComponent, IconRendererRecord>(ComponentID::IconRenderer,
+            [&](const IconRendererComponent& c, IconRendererRecord& r) {
+                r.icon_path = writer.intern(c.icon_path.string());
+                r.color     = c.color;
+            });
+
+        writer.add_section<CameraComponent, CameraRecord>(ComponentID::Camera, [](const CameraComponent& c, CameraRecord& r) {
+            r.projection_type    = (uint32_t)c.projection_type;
+            r.orthographic_size  = c.orthographic_size;
+            r.orthographic_near  = c.orthographic_near;
+            r.orthographic_far   = c.orthographic_far;
+            r.perspective_fov    = c.perspective_fov;
+            r.perspective_near   = c.perspective_near;
+            r.perspective_far    = c.perspective_far;
+            r.exposure           = c.exposure;
+            r.camera_size        = c.orthographic_size;
+            r.camera_fov         = c.perspective_fov;
+            r.aspect_ratio       = 1.6f;
+            r.fixed_aspect_ratio = c.fixed_aspect_ratio;
+            r.primary            = c.primary;
+
+            if (const Camera* camera = c.get_camera()) {
+                r.position     = camera->get_position();
+                r.aspect_ratio = camera->get_aspect_ratio();
+                if (auto* ortho = dynamic_cast<const OrthographicCamera*>(camera)) {
+                    r.camera_size    = ortho->get_size();
+                    r.ortho_rotation = ortho->get_rotation();
+                } else if (auto* persp = dynamic_cast<const PerspectiveCamera*>(camera)) {
+                    r.camera_fov     = persp->get_fov();
+                    r.persp_rotation = persp->get_rotation();
+                }
+            }
+        });
+
+        writer.add_section<NativeScriptComponent, NativeScriptRecord>(ComponentID::NativeScript,
+            [&](const NativeScriptComponent& c, NativeScriptRecord& r) {
+                r.script_name = writer.intern(c.script_name);
+            });
+
+        writer.add_section<ScriptComponent, ScriptRecord>(ComponentID::Script, [&](const ScriptComponent& c, ScriptRecord& r) {
+            r.script_name = writer.intern(c.script_name);
+        });
+
+        {
+            // Must follow the Script section: overrides are applied to an existing ScriptComponent.
+            std::vector<ScriptPropertyRecord> records;
+            auto view = registry.view<ScriptComponent>();
+            for (auto e : view) {
+                const uint32_t index = writer.index_of(e);
+                if (index == k_no_entity)
+                    continue;
+
+                for (const auto& [name, value] : view.get<ScriptComponent>(e).property_overrides) {
+                    ScriptPropertyRecord& r = records.emplace_back();
+                    r.entity = index;
+                    r.name   = writer.intern(name);
+                    if (const float* f = std::get_if<float>(&value)) {
+                        r.type = ScriptPropertyRecord::Type::Float;
+                        std::memcpy(&r.value, f, sizeof(float));
+                    } else if (const bool* b = std::get_if<bool>(&value)) {
+                        r.type  = ScriptPropertyRecord::Type::Bool;
+                        r.value = *b ? 1u : 0u;
+                    } else {
+                        r.type  = ScriptPropertyRecord::Type::String;
+                        r.value = writer.intern(std::get<std::string>(value));
+                    }
+                }
+            }
+            writer.add_section(ComponentID::ScriptProperty, records);
+        }
+
+        writer.add_section<Rigidbody2DComponent, Rigidbody2DRecord>(ComponentID::Rigidbody2D,
+            [](const Rigidbody2DComponent& c, Rigidbody2DRecord& r) {
+                r.body_type      = (uint32_t)c.body_type;
+                r.fixed_rotation = c.fixed_rotation;
+            });
+
+        writer.add_section<BoxCollider2DComponent, BoxCollider2DRecord>(ComponentID::BoxCollider2D,
+            [](const BoxCollider2DComponent& c, BoxCollider2DRecord& r) {
+                r.offset      = c.offset;
+                r.size        = c.size;
+                r.density     = c.density;
+                r.friction    = c.friction;
+                r.restitution = c.restitution;
+            });
+
+        writer.add_section<CircleCollider2DComponent, CircleCollider2DRecord>(ComponentID::CircleCollider2D,
+            [](const CircleCollider2DComponent& c, CircleCollider2DRecord& r) {
+                r.offset      = c.offset;
+                r.radius      = c.radius;
+                r.density     = c.density;
+                r.friction    = c.friction;
+                r.restitution = c.restitution;
+            });
+
+        writer.add_section<RigidbodyComponent, RigidbodyRecord>(ComponentID::Rigidbody, [](const RigidbodyComponent& c, RigidbodyRecord& r) {
+            r.body_type                = (uint32_t)c.body_type;
+            r.mass                     = c.mass;
+            r.friction                 = c.friction;
+            r.restitution              = c.restitution;
+            r.linear_damping           = c.linear_damping;
+            r.angular_damping          = c.angular_damping;
+            r.initial_linear_velocity  = c.initial_linear_velocity;
+            r.initial_angular_velocity = c.initial_angular_velocity;
+            r.gravity_factor           = c.gravity_factor;
+            r.is_sensor                = c.is_sensor;
+        });
+
+        writer.add_section<BoxCollider3DComponent, BoxCollider3DRecord>(ComponentID::BoxCollider3D,
+            [](const BoxCollider3DComponent& c, BoxCollider3DRecord& r) {
+                r.offset      = c.offset;
+                r.half_size   = c.half_size;
+                r.density     = c.density;
+                r.friction    = c.friction;
+                r.restitution = c.restitution;
+            });
+
+        writer.add_section<SphereCollider3DComponent, SphereCollider3DRecord>(ComponentID::SphereCollider3D,
+            [](const SphereCollider3DComponent& c, SphereCollider3DRecord& r) {
+                r.offset      = c.offset;
+                r.radius      = c.radius;
+                r.density     = c.density;
+                r.friction    = c.friction;
+                r.restitution = c.restitution;
+            });
+
+        writer.add_section<CapsuleCollider3DComponent, CapsuleCollider3DRecord>(ComponentID::CapsuleCollider3D,
+            [](const CapsuleCollider3DComponent& c, CapsuleCollider3DRecord& r) {
+                r.offset      = c.offset;
+                r.radius      = c.radius;
+                r.half_height = c.half_height;
+                r.density     = c.density;
+                r.friction    = c.friction;
+                r.restitution = c.restitution;
+            });
+
+        writer.add_section<ClothComponent, ClothRecord>(ComponentID::Cloth, [](const ClothComponent& c, ClothRecord& r) {
+            r.grid_width  = c.grid_width;
+            r.grid_height = c.grid_height;
+            r.substeps    = c.substeps;
+        });
+
+        writer.add_section<AudioSourceComponent, AudioSourceRecord>(ComponentID::AudioSource,
+            [&](const AudioSourceComponent& c, AudioSourceRecord& r) {
+                r.file_path           = writer.intern(c.file_path.string());
+                r.volume              = c.volume;
+                r.pitch               = c.pitch;
+                r.loop                = c.loop;
+                r.play_on_scene_start = c.play_on_scene_start;
+            });
+
+        writer.add_section<PointLightComponent, PointLightRecord>(ComponentID::PointLight,
+            [](const PointLightComponent& c, PointLightRecord& r) {
+                r.color     = c.color;
+                r.intensity = c.intensity;
+                r.range     = c.range;
+                r.enabled   = c.enabled;
+                r.shadows   = c.shadows;
+            });
+
+        writer.add_section<DirectionalLightComponent, DirectionalLightRecord>(ComponentID::DirectionalLight,
+            [](const DirectionalLightComponent& c, DirectionalLightRecord& r) {
+                r.color     = c.color;
+                r.intensity = c.intensity;
+                r.enabled   = c.enabled;
+                r.shadows   = c.shadows;
+            });
+
+        writer.add_section<SpotLightComponent, SpotLightRecord>(ComponentID::SpotLight,
+            [](const SpotLightComponent& c, SpotLightRecord& r) {
+                r.color       = c.color;
+                r.intensity   = c.intensity;
+                r.range       = c.range;
+                r.inner_angle = c.inner_angle;
+                r.outer_angle = c.outer_angle;
+                r.enabled     = c.enabled;
+                r.shadows     = c.shadows;
+            });
+
+        const std::vector<uint8_t> bytes = writer.finish();
+
+        std::filesystem::path file_path(path);
+        if (file_path.has_parent_path())
+            std::filesystem::create_directories(file_path.parent_path());
+
+        std::ofstream fout(path, std::ios::binary);
+        fout.write((const char*)bytes.data(), (std::streamsize)bytes.size());
+        fout.close();
+
+        HN_CORE_INFO("Serialized runtime scene to {0} ({1} bytes)", path.generic_string(), bytes.size());
+    }
+
+    void SceneSerializer::request_mesh_assets(MeshRendererComponent& mr, const std::string& mesh_path,
+                                              const std::string& gltf_source_path, const std::string& gltf_node_name) {
+        if (!gltf_source_path.empty() && !gltf_node_name.empty()) {
+            mr.gltf_source_path = gltf_source_path;
+            mr.gltf_node_name   = gltf_node_name;
+
+            if (!m_gltf_tree_cache.contains(gltf_source_path))
+                m_gltf_tree_cache[gltf_source_path] = load_gltf_scene_tree_async(gltf_source_path);
+            mr.gltf_async_handle = m_gltf_tree_cache.at(gltf_source_path);
+        } else if (!mesh_path.empty()) {
+            // Legacy flat-mesh import
+            mr.async_load_handle = load_gltf_mesh_async(mesh_path);
+            mr.mesh_path = mesh_path;
+        }
     }
 
     Entity SceneSerializer::deserialize_entity_node(YAML::Node& entity_node, bool generate_new_uuid) {
@@ -545,57 +984,8 @@ namespace Honey {
             int ppu = sprite_node["PPU"].as<int>(100);
             glm::vec2 pivot = sprite_node["Pivot"].as<glm::vec2>(glm::vec2(0.5f));
 
-            if (!texture_path_str.empty()) {
-                sprite.sprite_path = std::filesystem::path(texture_path_str);
-
-                Ref<Texture2D::AsyncHandle> tex_handle = Texture2D::create_async_manual(texture_path_str);
-
-                // If texture was already in cache or loaded instantly, this is valid now.
-                if (tex_handle && tex_handle->texture) {
-                    sprite.sprite = Sprite::create_from_texture(tex_handle->texture, ppu, pivot);
-                } else {
-                    // Optional: create a placeholder sprite if you want something visible
-                    // sprite.sprite = Sprite::create_placeholder(ppu, pivot);
-                }
-
-                TaskHandle wait_task = TaskSystem::run_async(
-                    [tex_handle, sprite_ptr = &sprite, ppu, pivot]() {
-                        // Wait until backend async completes this handle
-                        while (!tex_handle->done.load(std::memory_order_acquire)) {
-                            // Small sleep to avoid a tight busy-wait loop
-                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                        }
-
-                        // If it failed, leave whatever fallback we had
-                        if (tex_handle->failed.load(std::memory_order_acquire) ||
-                            !tex_handle->texture) {
-                            return;
-                        }
-
-                        Ref<Texture2D> final_tex = tex_handle->texture;
-
-                        // Schedule sprite update on main thread
-                        TaskSystem::enqueue_main(
-                            [sprite_ptr, final_tex, ppu, pivot]() {
-                                if (!sprite_ptr)
-                                    return;
-
-                                if (!sprite_ptr->sprite) {
-                                    // Sprite wasn't created yet; make it now.
-                                    sprite_ptr->sprite = Sprite::create_from_texture(
-                                        final_tex, ppu, pivot);
-                                } else {
-                                    // If Sprite supports changing texture in-place.
-                                    sprite_ptr->sprite->set_texture(final_tex);
-                                    sprite_ptr->sprite->recalc_size();
-                                }
-                            });
-                    });
-
-                // If you want to eventually join this specific wait_task somewhere, you can
-                // store TaskHandle(s). In many cases you can just let it run to completion.
-                (void)wait_task;
-            }
+            if (!texture_path_str.empty())
+                request_sprite_texture(sprite, texture_path_str, (float)ppu, pivot);
         }
 
         auto mesh_node = entity_node["MeshRendererComponent"];
@@ -607,18 +997,7 @@ namespace Honey {
             std::string gltf_source_path_str = mesh_node["GltfSourcePath"].as<std::string>("");
             std::string gltf_node_name_str = mesh_node["GltfNodeName"].as<std::string>("");
 
-            if (!gltf_source_path_str.empty() && !gltf_node_name_str.empty()) {
-                mr.gltf_source_path = gltf_source_path_str;
-                mr.gltf_node_name   = gltf_node_name_str;
-
-                if (!m_gltf_tree_cache.contains(gltf_source_path_str))
-                    m_gltf_tree_cache[gltf_source_path_str] = load_gltf_scene_tree_async(gltf_source_path_str);
-                mr.gltf_async_handle = m_gltf_tree_cache.at(gltf_source_path_str);
-            } else if (!mesh_path_str.empty()) {
-                // Legacy flat-mesh import
-                mr.async_load_handle = load_gltf_mesh_async(mesh_path_str);
-                mr.mesh_path = mesh_path_str;
-            }
+            request_mesh_assets(mr, mesh_path_str, gltf_source_path_str, gltf_node_name_str);
 
             // Optionally: material overrides
         }
@@ -967,7 +1346,7 @@ namespace Honey {
             tc.translation      = t.translation;
             tc.rotation         = t.rotation;
             tc.scale            = t.scale;
-            tc.dirty            = true;
+            m_scene->mark_transform_dirty(t.entity);
             tc.collider_dirty   = true;
         }
 
@@ -1032,7 +1411,7 @@ namespace Honey {
             tc.translation    = t.translation;
             tc.rotation       = t.rotation;
             tc.scale          = t.scale;
-            tc.dirty          = true;
+            m_scene->mark_transform_dirty(t.entity);
             tc.collider_dirty = true;
         }
         m_pending_transforms.clear();
@@ -1040,10 +1419,451 @@ namespace Honey {
         return entity;
     }
 
+    namespace {
+        // Read-only view over a serialize_runtime image. Never copies out of the buffer except for
+        // individual records, which are memcpy'd so the image itself needs no particular alignment.
+        class RuntimeSceneReader {
+        public:
+            RuntimeSceneReader(const uint8_t* data, size_t size) : m_data(data), m_size(size) {}
+
+            // Checks the header and that every table lies inside the image.
+            bool validate(const std::filesystem::path& path) {
+                using namespace SceneBinary;
+
+                if (m_size < sizeof(Header)) {
+                    HN_CORE_ERROR("Runtime scene '{}' is truncated", path.string());
+                    return false;
+                }
+                std::memcpy(&m_header, m_data, sizeof(Header));
+
+                if (m_header.magic != k_magic) {
+                    HN_CORE_ERROR("'{}' is not a runtime scene", path.string());
+                    return false;
+                }
+                if (m_header.version != k_version) {
+                    HN_CORE_ERROR("Runtime scene '{}' has version {}, expected {}", path.string(), m_header.version, k_version);
+                    return false;
+                }
+
+                auto in_bounds = [&](uint64_t offset, uint64_t bytes) { return offset <= m_size && bytes <= m_size - offset; };
+
+                const bool tables_ok =
+                    in_bounds(sizeof(Header), (uint64_t)m_header.section_count * sizeof(Section)) &&
+                    in_bounds(m_header.uuid_offset, (uint64_t)m_header.entity_count * sizeof(uint64_t)) &&
+                    in_bounds(m_header.string_table_offset, m_header.string_table_size) &&
+                    m_header.string_table_size > 0 &&
+                    m_data[m_header.string_table_offset + m_header.string_table_size - 1] == '\0';
+                if (!tables_ok) {
+                    HN_CORE_ERROR("Runtime scene '{}' is corrupt", path.string());
+                    return false;
+                }
+
+                for (uint32_t i = 0; i < m_header.section_count; ++i) {
+                    const Section s = section(i);
+                    if (!in_bounds(s.offset, (uint64_t)s.count * s.stride)) {
+                        HN_CORE_ERROR("Runtime scene '{}': section {} lies outside the file", path.string(), i);
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            const SceneBinary::Header& header() const { return m_header; }
+
+            SceneBinary::Section section(uint32_t index) const {
+                SceneBinary::Section s;
+                std::memcpy(&s, m_data + sizeof(SceneBinary::Header) + index * sizeof(SceneBinary::Section), sizeof(s));
+                return s;
+            }
+
+            UUID uuid(uint32_t index) const {
+                uint64_t id;
+                std::memcpy(&id, m_data + m_header.uuid_offset + index * sizeof(uint64_t), sizeof(id));
+                return (UUID)id;
+            }
+
+            // The table is NUL-terminated (checked by validate), so any in-range offset is a valid C string.
+            const char* string(SceneBinary::StringRef ref) const {
+                return ref < m_header.string_table_size ? (const char*)m_data + m_header.string_table_offset + ref : "";
+            }
+
+            // fn(entity, record) for every record whose entity index is in range.
+            template<typename Record, typename Fn>
+            void for_each(const SceneBinary::Section& s, const std::vector<entt::entity>& entities, Fn&& fn) const {
+                if (s.stride < sizeof(Record)) {
+                    HN_CORE_WARN("Runtime scene: skipping section {} with stride {} (< {})",
+                                 (uint32_t)s.component_id, s.stride, sizeof(Record));
+                    return;
+                }
+
+                const uint8_t* ptr = m_data + s.offset;
+                for (uint32_t i = 0; i < s.count; ++i, ptr += s.stride) {
+                    Record record;
+                    std::memcpy(&record, ptr, sizeof(Record));
+                    if (record.entity < entities.size())
+                        fn(entities[record.entity], record);
+                }
+            }
+
+            // Adds Component to every entity in the section, then fill(component, record).
+            template<typename Component, typename Record, typename Fill>
+            void emplace_all(entt::registry& registry, const SceneBinary::Section& s,
+                             const std::vector<entt::entity>& entities, Fill&& fill) const {
+                auto& storage = registry.storage<Component>();
+                storage.reserve(storage.size() + s.count);
+                for_each<Record>(s, entities, [&](entt::entity e, const Record& r) {
+                    fill(registry.emplace<Component>(e), r);
+                });
+            }
+
+        private:
+            const uint8_t* m_data;
+            size_t m_size;
+            SceneBinary::Header m_header{};
+        };
+    }
+
     bool SceneSerializer::deserialize_runtime(const std::filesystem::path &path) {
+        HN_PROFILE_FUNCTION();
+        using namespace SceneBinary;
+
+        // One read of the whole image; everything after this walks the buffer front to back.
+        // The reader only needs (pointer, size), so a mapped file works just as well.
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream.is_open()) {
+            HN_CORE_ERROR("Failed to open runtime scene: {}", path.string());
+            return false;
+        }
+        const std::streamsize size = stream.tellg();
+        std::vector<uint8_t> data(size > 0 ? (size_t)size : 0);
+        stream.seekg(0);
+        if (size <= 0 || !stream.read((char*)data.data(), size)) {
+            HN_CORE_ERROR("Failed to read runtime scene: {}", path.string());
+            return false;
+        }
+
+        RuntimeSceneReader reader(data.data(), data.size());
+        if (!reader.validate(path))
+            return false;
+
+        auto& registry = m_scene->m_registry;
+        const uint32_t entity_count = reader.header().entity_count;
+
+        // Entities and their always-present components go in as one batch per storage.
+        std::vector<entt::entity> entities(entity_count);
+        registry.create(entities.begin(), entities.end());
+        registry.insert<TransformComponent>(entities.begin(), entities.end());
+        registry.insert<TagComponent>(entities.begin(), entities.end());
+
+        registry.storage<IDComponent>().reserve(registry.storage<IDComponent>().size() + entity_count);
+        m_scene->m_entity_map.reserve(m_scene->m_entity_map.size() + entity_count);
+        for (uint32_t i = 0; i < entity_count; ++i) {
+            const UUID uuid = reader.uuid(i);
+            registry.emplace<IDComponent>(entities[i], uuid);
+            m_scene->m_entity_map[uuid] = entities[i];
+        }
 
-        //not implemented
-        HN_CORE_ASSERT(false, "Not implemented!");
-        return false;
+        for (uint32_t s = 0; s < reader.header().section_count; ++s) {
+            const Section section = reader.section(s);
+
+            switch (section.component_id) {
+                case ComponentID::Tag:
+                    reader.for_each<TagRecord>(section, entities, [&](entt::entity e, const TagRecord& r) {
+                        registry.get<TagComponent>(e).tag = reader.string(r.tag);
+                    });
+                    break;
+
+                case ComponentID::Transform:
+                    reader.for_each<TransformRecord>(section, entities, [&](entt::entity e, const TransformRecord& r) {
+                        auto& tc = registry.get<TransformComponent>(e);
+                        tc.translation = r.translation;
+                        tc.rotation    = r.rotation;
+                        tc.scale       = r.scale;
+                    });
+                    break;
+
+                case ComponentID::Relationship:
+                    reader.for_each<RelationshipRecord>(section, entities, [&](entt::entity child, const RelationshipRecord& r) {
+                        if (r.parent >= entity_count || entities[r.parent] == child)
+                            return;
+                        const entt::entity parent = entities[r.parent];
+                        registry.get_or_emplace<RelationshipComponent>(child).parent = parent;
+                        registry.get_or_emplace<RelationshipComponent>(parent).children.push_back(child);
+                    });
+                    break;
+
+                case ComponentID::SpriteRenderer:
+                    reader.emplace_all<SpriteRendererComponent, SpriteRendererRecord>(registry, section, entities,
+                        [&](SpriteRendererComponent& c, const SpriteRendererRecord& r) {
+                            c.color = r.color;
+                            if (r.texture_path != k_empty_string)
+                                request_sprite_texture(c, reader.string(r.texture_path), r.pixels_per_unit, r.pivot);
+                        });
+                    break;
+
+                case ComponentID::MeshRenderer:
+                    reader.emplace_all<MeshRendererComponent, MeshRendererRecord>(registry, section, entities,
+                        [&](MeshRendererComponent& c, const MeshRendererRecord& r) {
+                            c.color = r.color;
+                            request_mesh_assets(c, reader.string(r.mesh_path), reader.string(r.gltf_source_path),
+                                                reader.string(r.gltf_node_name));
+                        });
+                    break;
+
+                case ComponentID::CircleRenderer:
+                    reader.emplace_all<CircleRendererComponent, CircleRendererRecord>(registry, section, entities,
+                        [&](CircleRendererComponent& c, const CircleRendererRecord& r) {
+                            c.color     = r.color;
+                            c.thickness = r.thickness;
+                            c.fade      = r.fade;
+                            if (r.texture_path != k_empty_string) {
+                                c.texture_path = reader.string(r.texture_path);
+                                c.texture      = Texture2D::create_async(reader.string(r.texture_path));
+                            }
+                        });
+                    break;
+
+                case ComponentID::LineRenderer:
+                    reader.emplace_all<LineRendererComponent, LineRendererRecord>(registry, section, entities,
+                        [&](LineRendererComponent& c, const LineRendererRecord& r) {
+                            c.color = r.color;
+                            c.fade  = r.fade;
+                            if (r.texture_path != k_empty_string) {
+                                c.texture_path = reader.string(r.texture_path);
+                                c.texture      = Texture2D::create_async(reader.string(r.texture_path));
+                            }
+                        });
+                    break;
+
+                case ComponentID::TextRenderer:
+                    reader.emplace_all<TextRendererComponent, TextRendererRecord>(registry, section, entities,
+                        [&](TextRendererComponent& c, const TextRendererRecord& r) {
+                            c.text         = reader.string(r.text);
+                            c.font_path    = reader.string(r.font_path);
+                            c.color        = r.color;
+                            c.font_size    = r.font_size;
+                            c.line_spacing = r.line_spacing;
+                        });
+                    break;
+
+                case ComponentID::IconRenderer:
+                    reader.emplace_all<IconRendererComponent, IconRendererRecord>(registry, section, entities,
+                        [&](IconRendererComponent& c, const IconRendererRecord& r) {
+                            c.icon_path = reader.string(r.icon_path);
+                            c.color     = r.color;
+                        });
+                    break;
+
+                case ComponentID::Camera:
+                    reader.emplace_all<CameraComponent, CameraRecord>(registry, section, entities,
+                        [&](CameraComponent& c, const CameraRecord& r) {
+                            c.projection_type    = (CameraComponent::ProjectionType)r.projection_type;
+                            c.orthographic_size  = r.orthographic_size;
+                            c.orthographic_near  = r.orthographic_near;
+                            c.orthographic_far   = r.orthographic_far;
+                            c.perspective_fov    = r.perspective_fov;
+                            c.perspective_near   = r.perspective_near;
+                            c.perspective_far    = r.perspective_far;
+                            c.exposure           = r.exposure;
+                            c.fixed_aspect_ratio = r.fixed_aspect_ratio != 0;
+                            c.primary            = r.primary != 0;
+                            c.update_projection(r.aspect_ratio);
+
+                            Camera* camera = c.get_camera();
+                            camera->set_position(r.position);
+                            camera->set_exposure(c.exposure);
+                            if (auto* ortho = dynamic_cast<OrthographicCamera*>(camera)) {
+                                ortho->set_rotation(r.ortho_rotation);
+                                ortho->set_size(r.camera_size);
+                            } else if (auto* persp = dynamic_cast<PerspectiveCamera*>(camera)) {
+                                persp->set_fov(r.camera_fov);
+                                persp->set_rotation(r.persp_rotation);
+                            }
+                        });
+                    break;
+
+                case ComponentID::NativeScript:
+                    reader.emplace_all<NativeScriptComponent, NativeScriptRecord>(registry, section, entities,
+                        [&](NativeScriptComponent& c, const NativeScriptRecord& r) {
+                            if (r.script_name != k_empty_string)
+                                c.bind_by_name(reader.string(r.script_name));
+                        });
+                    break;
+
+                case ComponentID::Script:
+                    reader.emplace_all<ScriptComponent, ScriptRecord>(registry, section, entities,
+                        [&](ScriptComponent& c, const ScriptRecord& r) {
+                            c.script_name = reader.string(r.script_name);
+                        });
+                    break;
+
+                case ComponentID::ScriptProperty:
+                    reader.for_each<ScriptPropertyRecord>(section, entities, [&](entt::entity e, const ScriptPropertyRecord& r) {
+                        auto* sc = registry.try_get<ScriptComponent>(e);
+                        if (!sc)
+                            return;
+
+                        auto& value = sc->property_overrides[reader.string(r.name)];
+                        switch (r.type) {
+                            case ScriptPropertyRecord::Type::Float: {
+                                float f;
+                                std::memcpy(&f, &r.value, sizeof(float));
+                                value = f;
+                                break;
+                            }
+                            case ScriptPropertyRecord::Type::Bool:   value = r.value != 0; break;
+                            case ScriptPropertyRecord::Type::String: value = std::string(reader.string(r.value)); break;
+                        }
+                    });
+                    break;
+
+                case ComponentID::Rigidbody2D:
+                    reader.emplace_all<Rigidbody2DComponent, Rigidbody2DRecord>(registry, section, entities,
+                        [](Rigidbody2DComponent& c, const Rigidbody2DRecord& r) {
+                            c.body_type      = (Rigidbody2DComponent::BodyType)r.body_type;
+                            c.fixed_rotation = r.fixed_rotation != 0;
+                        });
+                    break;
+
+                case ComponentID::BoxCollider2D:
+                    reader.emplace_all<BoxCollider2DComponent, BoxCollider2DRecord>(registry, section, entities,
+                        [](BoxCollider2DComponent& c, const BoxCollider2DRecord& r) {
+                            c.offset      = r.offset;
+                            c.size        = r.size;
+                            c.density     = r.density;
+                            c.friction    = r.friction;
+                            c.restitution = r.restitution;
+                        });
+                    break;
+
+                case ComponentID::CircleCollider2D:
+                    reader.emplace_all<CircleCollider2DComponent, CircleCollider2DRecord>(registry, section, entities,
+                        [](CircleCollider2DComponent& c, const CircleCollider2DRecord& r) {
+                            c.offset      = r.offset;
+                            c.radius      = r.radius;
+                            c.density     = r.density;
+                            c.friction    = r.friction;
+                            c.restitution = r.restitution;
+                        });
+                    break;
+
+                case ComponentID::Rigidbody:
+                    reader.emplace_all<RigidbodyComponent, RigidbodyRecord>(registry, section, entities,
+                        [](RigidbodyComponent& c, const RigidbodyRecord& r) {
+                            c.body_type                = (RigidbodyComponent::BodyType)r.body_type;
+                            c.mass                     = r.mass;
+                            c.friction                 = r.friction;
+                            c.restitution              = r.restitution;
+                            c.linear_damping           = r.linear_damping;
+                            c.angular_damping          = r.angular_damping;
+                            c.initial_linear_velocity  = r.initial_linear_velocity;
+                            c.initial_angular_velocity = r.initial_angular_velocity;
+                            c.gravity_factor           = r.gravity_factor != 0;
+                            c.is_sensor                = r.is_sensor != 0;
+                        });
+                    break;
+
+                case ComponentID::BoxCollider3D:
+                    reader.emplace_all<BoxCollider3DComponent, BoxCollider3DRecord>(registry, section, entities,
+                        [](BoxCollider3DComponent& c, const BoxCollider3DRecord& r) {
+                            c.offset      = r.offset;
+                            c.half_size   = r.half_size;
+                            c.density     = r.density;
+                            c.friction    = r.friction;
+                            c.restitution = r.restitution;
+                        });
+                    break;
+
+                case ComponentID::SphereCollider3D:
+                    reader.emplace_all<SphereCollider3DComponent, SphereCollider3DRecord>(registry, section, entities,
+                        [](SphereCollider3DComponent& c, const SphereCollider3DRecord& r) {
+                            c.offset      = r.offset;
+                            c.radius      = r.radius;
+                            c.density     = r.density;
+                            c.friction    = r.friction;
+                            c.restitution = r.restitution;
+                        });
+                    break;
+
+                case ComponentID::CapsuleCollider3D:
+                    reader.emplace_all<CapsuleCollider3DComponent, CapsuleCollider3DRecord>(registry, section, entities,
+                        [](CapsuleCollider3DComponent& c, const CapsuleCollider3DRecord& r) {
+                            c.offset      = r.offset;
+                            c.radius      = r.radius;
+                            c.half_height = r.half_height;
+                            c.density     = r.density;
+                            c.friction    = r.friction;
+                            c.restitution = r.restitution;
+                        });
+                    break;
+
+                case ComponentID::Cloth:
+                    reader.emplace_all<ClothComponent, ClothRecord>(registry, section, entities,
+                        [](ClothComponent& c, const ClothRecord& r) {
+                            c.grid_width  = r.grid_width;
+                            c.grid_height = r.grid_height;
+                            c.substeps    = r.substeps;
+                        });
+                    break;
+
+                case ComponentID::AudioSource:
+                    reader.emplace_all<AudioSourceComponent, AudioSourceRecord>(registry, section, entities,
+                        [&](AudioSourceComponent& c, const AudioSourceRecord& r) {
+                            c.file_path           = reader.string(r.file_path);
+                            c.volume              = r.volume;
+                            c.pitch               = r.pitch;
+                            c.loop                = r.loop != 0;
+                            c.play_on_scene_start = r.play_on_scene_start != 0;
+                        });
+                    break;
+
+                case ComponentID::PointLight:
+                    reader.emplace_all<PointLightComponent, PointLightRecord>(registry, section, entities,
+                        [](PointLightComponent& c, const PointLightRecord& r) {
+                            c.color     = r.color;
+                            c.intensity = r.intensity;
+                            c.range     = r.range;
+                            c.enabled   = r.enabled != 0;
+                            c.shadows   = r.shadows != 0;
+                        });
+                    break;
+
+                case ComponentID::DirectionalLight:
+                    reader.emplace_all<DirectionalLightComponent, DirectionalLightRecord>(registry, section, entities,
+                        [](DirectionalLightComponent& c, const DirectionalLightRecord& r) {
+                            c.color     = r.color;
+                            c.intensity = r.intensity;
+                            c.enabled   = r.enabled != 0;
+                            c.shadows   = r.shadows != 0;
+                        });
+                    break;
+
+                case ComponentID::SpotLight:
+                    reader.emplace_all<SpotLightComponent, SpotLightRecord>(registry, section, entities,
+                        [](SpotLightComponent& c, const SpotLightRecord& r) {
+                            c.color       = r.color;
+                            c.intensity   = r.intensity;
+                            c.range       = r.range;
+                            c.inner_angle = r.inner_angle;
+                            c.outer_angle = r.outer_angle;
+                            c.enabled     = r.enabled != 0;
+                            c.shadows     = r.shadows != 0;
+                        });
+                    break;
+
+                default:
+                    // Written by a newer engine; skip what we do not understand.
+                    break;
+            }
+        }
+
+        // Hierarchy links were written straight into RelationshipComponent, so the transform order
+        // is rebuilt once on the next update instead of being spliced entity by entity. That full
+        // pass also computes every world matrix (new transforms start dirty).
+        m_scene->m_transform_order_valid = false;
+        m_scene->mark_dirty();
+
+        m_loaded_editor_meta = EditorSceneMeta{};
+        return true;
     }
 }
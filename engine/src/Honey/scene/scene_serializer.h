@@ -48,6 +48,10 @@ namespace Honey {
             glm::vec3 scale;
         };
 
+        // Kicks off the async mesh / glTF node load shared by the YAML and runtime paths.
+        void request_mesh_assets(MeshRendererComponent& mr, const std::string& mesh_path,
+                                 const std::string& gltf_source_path, const std::string& gltf_node_name);
+
         Ref<Scene> m_scene;
         std::vector<PendingRelationship> m_pending_relationships;
         std::vector<PendingTransform> m_pending_transforms;
@@ -0,0 +1,145 @@
+#include "hnpch.h"
+#include "system_scheduler.h"
+
+#include "Honey/core/timer.h"
+
+#include <algorithm>
+
+namespace Honey {
+
+    namespace {
+        constexpr float k_timing_smoothing = 0.1f;
+
+        template<typename Key>
+        bool overlaps(const std::vector<Key>& a, const std::vector<Key>& b) {
+            for (const Key& key : a) {
+                if (std::find(b.begin(), b.end(), key) != b.end())
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    SystemScheduler::Stage& SystemScheduler::add(std::string name, StageFunction fn) {
+        Stage& stage = m_stages.emplace_back();
+        stage.m_id = (StageID)(m_stages.size() - 1);
+        stage.m_name = std::move(name);
+        stage.m_fn = std::move(fn);
+        m_timings.emplace_back();
+        return stage;
+    }
+
+    bool SystemScheduler::conflicts(const Stage& a, const Stage& b) const {
+        if (a.m_exclusive || b.m_exclusive)
+            return true;
+        return overlaps(a.m_writes, b.m_writes)
+            || overlaps(a.m_writes, b.m_reads)
+            || overlaps(a.m_reads, b.m_writes)
+            || overlaps(a.m_resource_writes, b.m_resource_writes)
+            || overlaps(a.m_resource_writes, b.m_resource_reads)
+            || overlaps(a.m_resource_reads, b.m_resource_writes);
+    }
+
+    void SystemScheduler::build_waves() {
+        // A stage's wave is one past the latest wave among the earlier stages it conflicts with.
+        // The stage count is small, so the quadratic scan is cheaper than maintaining edges.
+        m_stage_wave.assign(m_stages.size(), 0);
+        m_wave_order.clear();
+        m_wave_count = 0;
+
+        for (StageID b = 0; b < (StageID)m_stages.size(); ++b) {
+            if (!m_stages[b].m_enabled)
+                continue;
+
+            uint32_t wave = 0;
+            for (StageID a = 0; a < b; ++a) {
+                if (m_stages[a].m_enabled && conflicts(m_stages[a], m_stages[b]))
+                    wave = std::max(wave, m_stage_wave[a] + 1);
+            }
+            m_stage_wave[b] = wave;
+            m_wave_order.push_back(b);
+            m_wave_count = std::max(m_wave_count, wave + 1);
+        }
+
+        std::stable_sort(m_wave_order.begin(), m_wave_order.end(),
+                         [&](StageID a, StageID b) { return m_stage_wave[a] < m_stage_wave[b]; });
+    }
+
+    void SystemScheduler::run_stage(StageID id, Timestep ts, bool on_worker) {
+        Stage& stage = m_stages[id];
+        HN_PROFILE_SCOPE(stage.m_name.c_str());
+
+        Timer timer;
+        stage.m_fn(ts);
+
+        StageTiming& timing = m_timings[id];
+        timing.last_ms = timer.elapsed_millis();
+        timing.avg_ms = timing.avg_ms == 0.0f
+            ? timing.last_ms
+            : timing.avg_ms + (timing.last_ms - timing.avg_ms) * k_timing_smoothing;
+        timing.on_worker = on_worker;
+        timing.ran = true;
+    }
+
+    void SystemScheduler::run(Timestep ts) {
+        HN_PROFILE_FUNCTION();
+        Timer frame_timer;
+
+        build_waves();
+
+        for (StageID id = 0; id < (StageID)m_stages.size(); ++id) {
+            StageTiming& timing = m_timings[id];
+            timing.name = m_stages[id].m_name.c_str();
+            timing.last_ms = 0.0f;
+            timing.wave = m_stage_wave[id];
+            timing.ran = false;
+        }
+
+        const bool parallel = TaskSystem::is_initialized();
+        if (parallel) {
+            for (StageID id : m_wave_order) {
+                for (auto assure : m_stages[id].m_assure)
+                    assure(m_registry);
+            }
+        }
+
+        size_t first = 0;
+        while (first < m_wave_order.size()) {
+            const uint32_t wave = m_stage_wave[m_wave_order[first]];
+            size_t last = first;
+            bool caller_busy = false;
+            while (last < m_wave_order.size() && m_stage_wave[m_wave_order[last]] == wave) {
+                caller_busy |= m_stages[m_wave_order[last]].m_main_thread;
+                ++last;
+            }
+
+            // Hand the stages that may leave this thread to workers, keeping one for this thread
+            // when no main-thread stage will occupy it.
+            m_caller_stages.clear();
+            for (size_t i = first; i < last; ++i) {
+                const StageID id = m_wave_order[i];
+                if (parallel && !m_stages[id].m_main_thread && caller_busy)
+                    m_handles.push_back(TaskSystem::run_async([this, id, ts]() { run_stage(id, ts, true); },
+                                                              TaskLane::frame_critical));
+                else
+                    m_caller_stages.push_back(id);
+                caller_busy = true;
+            }
+
+            for (StageID id : m_caller_stages)
+                run_stage(id, ts, false);
+
+            for (TaskHandle& handle : m_handles)
+                TaskSystem::wait(handle);
+            m_handles.clear();
+
+            first = last;
+        }
+
+        m_frame_ms = frame_timer.elapsed_millis();
+        m_serial_ms = 0.0f;
+        for (const StageTiming& timing : m_timings)
+            m_serial_ms += timing.last_ms;
+    }
+
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <entt/entt.hpp>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Honey/core/task_system.h"
+#include "Honey/core/timestep.h"
+
+namespace Honey {
+
+    // Runs a scene's per-frame update stages, overlapping the ones that cannot interfere.
+    //
+    // Each stage declares the component types it reads and writes, plus any other state it shares
+    // with other stages (a queue, a lookup table) as a resource, named by its address. Every frame the enabled stages
+    // are ordered into a DAG: a stage depends on each earlier stage that writes something it
+    // touches or touches something it writes, so stages keep their declaration order wherever it
+    // matters. The DAG runs wave by wave: a wave holds the stages whose dependencies are all done,
+    // run concurrently on the TaskSystem, with the calling thread taking part.
+    //
+    // An exclusive stage conflicts with everything and runs alone on the calling thread. Use it
+    // for stages that create or destroy entities, or that call into scripts. A main-thread stage
+    // may overlap with other stages, but it always runs on the calling thread itself.
+    class SystemScheduler {
+    public:
+        using StageID = uint32_t;
+        using StageFunction = std::function<void(Timestep)>;
+
+        struct Stage {
+            template<typename... Components>
+            Stage& reads() {
+                (add_access<Components>(m_reads), ...);
+                return *this;
+            }
+            template<typename... Components>
+            Stage& writes() {
+                (add_access<Components>(m_writes), ...);
+                return *this;
+            }
+            Stage& reads_resource(const void* resource) {
+                m_resource_reads.push_back(resource);
+                return *this;
+            }
+            Stage& writes_resource(const void* resource) {
+                m_resource_writes.push_back(resource);
+                return *this;
+            }
+            Stage& exclusive() { m_exclusive = true; return *this; }
+            Stage& main_thread() { m_main_thread = true; return *this; }
+
+            StageID id() const { return m_id; }
+
+        private:
+            template<typename Component>
+            void add_access(std::vector<entt::id_type>& types) {
+                types.push_back(entt::type_hash<Component>::value());
+                // Views and gets create missing storages, which would race with other stages.
+                // The scheduler creates them up front instead.
+                m_assure.push_back([](entt::registry& registry) { (void)registry.storage<Component>(); });
+            }
+
+            StageID m_id = 0;
+            std::string m_name;
+            StageFunction m_fn;
+            std::vector<entt::id_type> m_reads;
+            std::vector<entt::id_type> m_writes;
+            std::vector<const void*> m_resource_reads;
+            std::vector<const void*> m_resource_writes;
+            std::vector<void (*)(entt::registry&)> m_assure;
+            bool m_exclusive = false;
+            bool m_main_thread = false;
+            bool m_enabled = true;
+
+            friend class SystemScheduler;
+        };
+
+        struct StageTiming {
+            const char* name = "";
+            float last_ms = 0.0f;   // 0 when the stage did not run this frame
+            float avg_ms = 0.0f;    // exponential moving average over the frames it ran
+            uint32_t wave = 0;
+            bool on_worker = false;
+            bool ran = false;
+        };
+
+        explicit SystemScheduler(entt::registry& registry) : m_registry(registry) {}
+
+        // Stages run in declaration order wherever their accesses conflict.
+        Stage& add(std::string name, StageFunction fn);
+        void set_enabled(StageID stage, bool enabled) { m_stages[stage].m_enabled = enabled; }
+
+        void run(Timestep ts);
+
+        // Per-stage timings of the last run, in declaration order.
+        const std::vector<StageTiming>& get_timings() const { return m_timings; }
+        // Wall time of the last run, and what it would have been with every stage run serially.
+        float get_frame_ms() const { return m_frame_ms; }
+        float get_serial_ms() const { return m_serial_ms; }
+        uint32_t get_wave_count() const { return m_wave_count; }
+
+    private:
+        void build_waves();
+        void run_stage(StageID stage, Timestep ts, bool on_worker);
+        bool conflicts(const Stage& a, const Stage& b) const;
+
+        entt::registry& m_registry;
+        std::vector<Stage> m_stages;
+        std::vector<StageTiming> m_timings;
+
+        // Scratch, reused every frame.
+        std::vector<uint32_t> m_stage_wave;
+        std::vector<StageID> m_wave_order;  // enabled stages sorted by wave
+        std::vector<StageID> m_caller_stages;
+        std::vector<TaskHandle> m_handles;
+
+        float m_frame_ms = 0.0f;
+        float m_serial_ms = 0.0f;
+        uint32_t m_wave_count = 0;
+    };
+
+}
@@ -13,6 +13,8 @@
 namespace Honey {
     static constexpr const char* k_registry_type =
         "HoneyEngine.ScriptRegistry, HoneyEngine";
+    static constexpr const char* k_benchmarks_type =
+        "HoneyEngine.Benchmarks, HoneyEngine";
 
     // ---------------------------------------------------------------------------
     // Internal data
@@ -31,8 +33,11 @@ namespace Honey {
         using DestroyInstanceFn   = void     (*)(intptr_t);
         using CallOnCreateFn      = void     (*)(intptr_t, uint64_t);
         using CallOnUpdateFn      = void     (*)(intptr_t, uint64_t, float);
+        using CallOnUpdateBatchFn = void     (*)(const intptr_t*, int32_t, float);
         using CallOnDestroyFn     = void     (*)(intptr_t, uint64_t);
-        using CallCollisionFn     = void     (*)(intptr_t, uint64_t, uint64_t);
+        using ListensForCollisionsFn = uint8_t (*)(intptr_t);
+        using CallCollisionBatchFn   = void    (*)(const intptr_t*, const uint64_t*, const uint8_t*, int32_t);
+        using RunBenchmarksFn        = void    (*)();
 
         RegisterAssemblyFn  register_assembly    = nullptr;
         UnloadAssemblyFn    unload_assembly      = nullptr;
@@ -41,14 +46,22 @@ namespace Honey {
         DestroyInstanceFn   destroy_instance     = nullptr;
         CallOnCreateFn      call_on_create       = nullptr;
         CallOnUpdateFn      call_on_update       = nullptr;
+        CallOnUpdateBatchFn call_on_update_batch = nullptr;
         CallOnDestroyFn     call_on_destroy      = nullptr;
-        CallCollisionFn     call_collision_begin = nullptr;
-        CallCollisionFn     call_collision_end   = nullptr;
+        ListensForCollisionsFn listens_for_collisions = nullptr;
+        CallCollisionBatchFn   call_collision_batch   = nullptr;
+        RunBenchmarksFn        run_benchmarks         = nullptr;  // optional, debug only
 
         // Per-entity GCHandles (nint stored as intptr_t)
         std::unordered_map<UUID, intptr_t> entity_instances;
 
+        // Scripts destroyed while a batched update or collision call is running. Managed code
+        // skips them for the rest of the batch; their handles are only freed once it returns.
+        bool in_batch = false;
+        std::vector<intptr_t> deferred_destroys;
+
         bool assembly_loaded = false;
+        uint32_t script_generation = 1;
     };
 
     std::unique_ptr<CSharpScriptEngine::Data> CSharpScriptEngine::s_data = nullptr;
@@ -92,15 +105,18 @@ namespace Honey {
         s_data->destroy_instance     = (Data::DestroyInstanceFn)  load("DestroyInstance");
         s_data->call_on_create       = (Data::CallOnCreateFn)     load("CallOnCreate");
         s_data->call_on_update       = (Data::CallOnUpdateFn)     load("CallOnUpdate");
+        s_data->call_on_update_batch = (Data::CallOnUpdateBatchFn)load("CallOnUpdateBatch");
         s_data->call_on_destroy      = (Data::CallOnDestroyFn)    load("CallOnDestroy");
-        s_data->call_collision_begin = (Data::CallCollisionFn)    load("CallCollisionBegin");
-        s_data->call_collision_end   = (Data::CallCollisionFn)    load("CallCollisionEnd");
+        s_data->listens_for_collisions = (Data::ListensForCollisionsFn)load("ListensForCollisions");
+        s_data->call_collision_batch   = (Data::CallCollisionBatchFn)  load("CallCollisionBatch");
+        s_data->run_benchmarks         = (Data::RunBenchmarksFn)
+            s_data->host.load_managed_function(honey_dll, k_benchmarks_type, "RunAll");
 
         auto& d = *s_data;
         if (!d.register_assembly || !d.unload_assembly || !d.class_exists
             || !d.create_instance || !d.destroy_instance
-            || !d.call_on_create  || !d.call_on_update  || !d.call_on_destroy
-            || !d.call_collision_begin || !d.call_collision_end) {
+            || !d.call_on_create  || !d.call_on_update  || !d.call_on_update_batch || !d.call_on_destroy
+            || !d.listens_for_collisions || !d.call_collision_batch) {
             HN_CORE_ERROR("[CSharpScriptEngine] one or more managed fn ptrs failed to load");
             return;
             }
@@ -130,6 +146,7 @@ namespace Honey {
             }
             s_data->register_assembly(s_data->user_scripts_dll.c_str());
             s_data->assembly_loaded = true;
+            s_data->script_generation++;
         }
     }
 
@@ -144,6 +161,7 @@ namespace Honey {
 
         s_data->unload_assembly();
         s_data->assembly_loaded = false;
+        s_data->script_generation++;
         CSharpScriptGlue::set_scene_context(nullptr);
         s_data->scene_context = nullptr;
     }
@@ -167,6 +185,8 @@ namespace Honey {
 
         UUID uuid = entity.get_uuid();
         s_data->entity_instances[uuid] = handle;
+        sc.instance = handle;
+        sc.collision_listener = s_data->listens_for_collisions(handle) != 0;
         s_data->call_on_create(handle, (uint64_t)uuid);
     }
 
@@ -181,6 +201,26 @@ namespace Honey {
         s_data->call_on_update(it->second, (uint64_t)uuid, (float)ts);
     }
 
+    void CSharpScriptEngine::on_update_entities(const intptr_t* handles, uint32_t count, Timestep ts) {
+        HN_PROFILE_FUNCTION();
+        if (!s_data || !s_data->initialized || count == 0) return;
+
+        s_data->in_batch = true;
+        s_data->call_on_update_batch(handles, (int32_t)count, (float)ts);
+        s_data->in_batch = false;
+        free_deferred_destroys();
+    }
+
+    void CSharpScriptEngine::free_deferred_destroys() {
+        for (intptr_t handle : s_data->deferred_destroys)
+            s_data->destroy_instance(handle);
+        s_data->deferred_destroys.clear();
+    }
+
+    uint32_t CSharpScriptEngine::get_script_generation() {
+        return s_data ? s_data->script_generation : 0;
+    }
+
     void CSharpScriptEngine::on_destroy_entity(Entity entity) {
         if (!s_data || !s_data->initialized) return;
 
@@ -189,26 +229,31 @@ namespace Honey {
         if (it == s_data->entity_instances.end()) return;
 
         s_data->call_on_destroy(it->second, (uint64_t)uuid);
-        s_data->destroy_instance(it->second);
+        if (s_data->in_batch)
+            s_data->deferred_destroys.push_back(it->second); // still referenced by the running batch
+        else
+            s_data->destroy_instance(it->second);
         s_data->entity_instances.erase(it);
-    }
 
-    void CSharpScriptEngine::on_collision_begin(Entity a, Entity b) {
-        if (!s_data || !s_data->initialized) return;
-
-        auto it = s_data->entity_instances.find(a.get_uuid());
-        if (it == s_data->entity_instances.end()) return;
-
-        s_data->call_collision_begin(it->second, (uint64_t)a.get_uuid(), (uint64_t)b.get_uuid());
+        if (auto* sc = entity.try_get_component<ScriptComponent>()) {
+            sc->instance = 0;
+            sc->collision_listener = false;
+        }
     }
 
-    void CSharpScriptEngine::on_collision_end(Entity a, Entity b) {
-        if (!s_data || !s_data->initialized) return;
+    bool CSharpScriptEngine::listens_for_collisions(intptr_t handle) {
+        if (!s_data || !s_data->initialized || !handle) return false;
+        return s_data->listens_for_collisions(handle) != 0;
+    }
 
-        auto it = s_data->entity_instances.find(a.get_uuid());
-        if (it == s_data->entity_instances.end()) return;
+    void CSharpScriptEngine::on_collisions(const intptr_t* handles, const uint64_t* other_ids, const uint8_t* begins, uint32_t count) {
+        HN_PROFILE_FUNCTION();
+        if (!s_data || !s_data->initialized || count == 0) return;
 
-        s_data->call_collision_end(it->second, (uint64_t)a.get_uuid(), (uint64_t)b.get_uuid());
+        s_data->in_batch = true;
+        s_data->call_collision_batch(handles, other_ids, begins, (int32_t)count);
+        s_data->in_batch = false;
+        free_deferred_destroys();
     }
 
     bool CSharpScriptEngine::build_and_reload() {
@@ -232,6 +277,16 @@ namespace Honey {
         return true;
     }
 
+    bool CSharpScriptEngine::run_benchmarks() {
+        if (!s_data || !s_data->initialized || !s_data->run_benchmarks) {
+            HN_CORE_ERROR("[CSharpScriptEngine] script benchmarks unavailable — scripting host not initialized");
+            return false;
+        }
+
+        s_data->run_benchmarks();
+        return true;
+    }
+
     void CSharpScriptEngine::reload_scripts() {
         if (!s_data || !s_data->initialized) return;
 
@@ -243,6 +298,7 @@ namespace Honey {
 
         s_data->unload_assembly();
         s_data->assembly_loaded = false;
+        s_data->script_generation++;
 
         if (std::filesystem::exists(s_data->user_scripts_dll)) {
             s_data->register_assembly(s_data->user_scripts_dll.c_str());
@@ -19,10 +19,19 @@ namespace Honey {
         static bool entity_class_exists(const std::string& class_name);
         static void on_create_entity(Entity entity);
         static void on_update_entity(Entity entity, Timestep ts);
+        // OnUpdate for every script in one native->managed transition. `handles` holds each
+        // script's ScriptComponent::instance; a script already knows its own entity.
+        static void on_update_entities(const intptr_t* handles, uint32_t count, Timestep ts);
         static void on_destroy_entity(Entity entity);
 
-        static void on_collision_begin(Entity a, Entity b);
-        static void on_collision_end(Entity a, Entity b);
+        // Changes whenever the script assembly is loaded, unloaded or reloaded.
+        static uint32_t get_script_generation();
+
+        // Whether the script behind `handle` overrides OnCollisionBegin/OnCollisionEnd.
+        static bool listens_for_collisions(intptr_t handle);
+        // A frame's collision callbacks in one native->managed transition. Parallel arrays: the
+        // receiving script's handle, the other entity's UUID and 1 for begin / 0 for end.
+        static void on_collisions(const intptr_t* handles, const uint64_t* other_ids, const uint8_t* begins, uint32_t count);
 
         static Scene* get_scene_context();
 
@@ -32,7 +41,13 @@ namespace Honey {
         // Runs `dotnet build` on the user script project, then reloads. Returns true on success.
         static bool build_and_reload();
 
+        // Runs HoneyEngine.Benchmarks.RunAll. Jobs.ParallelFor needs the TaskSystem up. Returns
+        // false when the scripting host is not available.
+        static bool run_benchmarks();
+
     private:
+        static void free_deferred_destroys();
+
         struct Data;
         static std::unique_ptr<Data> s_data;
     };
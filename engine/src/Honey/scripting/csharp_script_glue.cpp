@@ -5,7 +5,9 @@
 #include "Honey/scene/components.h"
 #include "Honey/core/input.h"
 #include "Honey/core/keycodes.h"
+#include "Honey/core/task_system.h"
 #include <box2d/box2d.h>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 
@@ -51,8 +53,21 @@ namespace Honey {
         uint64_t (*Scene_FindEntityByName)         (const char*);
         float   (*Input_GetMouseDeltaX)            ();
         float   (*Input_GetMouseDeltaY)            ();
+
+        uint32_t (*Scene_OverlapSphere)            (float*, float, uint64_t*, uint32_t);
+        uint64_t (*Scene_Raycast)                  (float*, float*, float, float*);
+
+        uint32_t (*Transform_Lease)                (const uint64_t*, uint32_t, TransformComponent**);
+        uint32_t (*Transform_GetDirtyOffset)       ();
+
+        void    (*Jobs_ParallelFor)                (uint32_t, uint32_t, void (*)(void*, uint32_t, uint32_t), void*);
     };
 
+    // Managed code reads TransformComponent through TransformData, which mirrors this prefix.
+    static_assert(offsetof(TransformComponent, translation) == 0);
+    static_assert(offsetof(TransformComponent, rotation)    == 12);
+    static_assert(offsetof(TransformComponent, scale)       == 24);
+
     // -----------------------------------------------------------------------
     // Helpers
     // -----------------------------------------------------------------------
@@ -83,7 +98,7 @@ namespace Honey {
         Entity e = scene->get_entity(UUID{id});
         auto& tc = e.get_component<TransformComponent>();
         tc.translation = { v[0], v[1], v[2] };
-        tc.dirty = true;
+        scene->mark_transform_dirty(e);
     }
 
     static void glue_entity_get_rotation(uint64_t id, float* out) {
@@ -102,7 +117,7 @@ namespace Honey {
         Entity e = scene->get_entity(UUID{id});
         auto& tc = e.get_component<TransformComponent>();
         tc.rotation = { v[0], v[1], v[2] };
-        tc.dirty = true;
+        scene->mark_transform_dirty(e);
     }
 
     static void glue_entity_get_scale(uint64_t id, float* out) {
@@ -121,10 +136,29 @@ namespace Honey {
         Entity e = scene->get_entity(UUID{id});
         auto& tc = e.get_component<TransformComponent>();
         tc.scale = { v[0], v[1], v[2] };
-        tc.dirty = true;
+        scene->mark_transform_dirty(e);
         tc.collider_dirty = true;
     }
 
+    // Resolves each UUID to its TransformComponent (null when the entity is gone) and returns how
+    // many resolved. The pointers live until the scene's next script-write flush.
+    static uint32_t glue_transform_lease(const uint64_t* ids, uint32_t count, TransformComponent** out) {
+        Scene* scene = get_scene();
+        HN_CORE_ASSERT(scene, "CSharpScriptGlue: no active scene");
+
+        uint32_t resolved = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            Entity e = scene->get_entity(UUID{ids[i]});
+            out[i] = e.is_valid() ? scene->lease_transform(e) : nullptr;
+            resolved += out[i] != nullptr;
+        }
+        return resolved;
+    }
+
+    static uint32_t glue_transform_get_dirty_offset() {
+        return (uint32_t)offsetof(TransformComponent, dirty);
+    }
+
     // -----------------------------------------------------------------------
     // Scene glue
     // -----------------------------------------------------------------------
@@ -167,10 +201,7 @@ namespace Honey {
     static void glue_rigidbody_get_velocity(uint64_t entity_id, float* out_xyz) {
         Entity e = CSharpScriptEngine::get_scene_context()->get_entity(UUID{entity_id});
         if (!e.has_component<RigidbodyComponent>()) return;
-        auto& rb = e.get_component<RigidbodyComponent>();
-        JPH::BodyID id{rb.runtime_body_id};
-
-        glm::vec3 vel = PhysicsEngine3D::get().get_velocity(id);
+        glm::vec3 vel = PhysicsEngine3D::get().get_velocity(e);
         HN_CORE_ASSERT(sizeof(out_xyz) == sizeof(glm::vec3), "CSharpScriptGlue: invalid output size");
         out_xyz[0] = vel.x;
         out_xyz[1] = vel.y;
@@ -226,8 +257,9 @@ namespace Honey {
         Scene* scene = get_scene();
         HN_CORE_ASSERT(scene, "CSharpScriptGlue: no active scene");
         Entity e = scene->get_entity(UUID{id});
+        // Deferred so transforms leased by scripts this frame stay where they are.
         if (e.is_valid())
-            scene->destroy_entity(e);
+            scene->destroy_entity_deferred(e);
     }
 
     // -----------------------------------------------------------------------
@@ -240,6 +272,61 @@ namespace Honey {
         return e.is_valid() ? (uint64_t)e.get_uuid() : 0;
     }
 
+    // Writes up to `capacity` entity IDs into out_ids and returns the total number of hits,
+    // so the caller can retry with a larger buffer if it was too small.
+    static uint32_t glue_scene_overlap_sphere(float* center, float radius, uint64_t* out_ids, uint32_t capacity) {
+        Scene* scene = get_scene();
+        HN_CORE_ASSERT(scene, "CSharpScriptGlue: no active scene");
+        auto& registry = scene->get_registry();
+
+        uint32_t hits = 0;
+        scene->get_spatial_tree().query_sphere({ center[0], center[1], center[2] }, radius, [&](entt::entity e) {
+            if (hits < capacity)
+                out_ids[hits] = (uint64_t)registry.get<IDComponent>(e).id;
+            ++hits;
+            return true;
+        });
+        return hits;
+    }
+
+    static uint64_t glue_scene_raycast(float* origin, float* direction, float max_distance, float* out_distance) {
+        Scene* scene = get_scene();
+        HN_CORE_ASSERT(scene, "CSharpScriptGlue: no active scene");
+
+        const glm::vec3 dir(direction[0], direction[1], direction[2]);
+        const float len = glm::length(dir);
+        if (len <= 0.0f)
+            return 0;
+
+        Entity e = scene->raycast_bounds({ origin[0], origin[1], origin[2] }, dir / len, max_distance, out_distance);
+        return e.is_valid() ? (uint64_t)e.get_uuid() : 0;
+    }
+
+    // -----------------------------------------------------------------------
+    // Jobs glue
+    // -----------------------------------------------------------------------
+    using JobRangeFn = void(*)(void* context, uint32_t begin, uint32_t end);
+
+    // Splits [0, count) into ranges of at least batch_size indices and runs fn(context, begin, end)
+    // for each on the task system's workers, returning once all are done. The calling thread helps
+    // while it waits. Rules on what the batches may touch are enforced on the managed side (Jobs.cs).
+    static void glue_jobs_parallel_for(uint32_t count, uint32_t batch_size, JobRangeFn fn, void* context) {
+        if (count == 0)
+            return;
+
+        batch_size = std::max(batch_size, 1u);
+        if (count <= batch_size || !TaskSystem::is_initialized()) {
+            fn(context, 0, count);
+            return;
+        }
+
+        // One managed transition per partition; batch_size keeps partitions from getting finer than that.
+        TaskHandle handle = TaskSystem::parallel_for(0, count, [=](uint32_t start, uint32_t end) {
+            fn(context, start, end);
+        }, batch_size);
+        TaskSystem::wait(handle);
+    }
+
     // -----------------------------------------------------------------------
     // Public API
     // -----------------------------------------------------------------------
@@ -289,6 +376,17 @@ namespace Honey {
             // Mouse delta
             glue_input_get_mouse_delta_x,
             glue_input_get_mouse_delta_y,
+
+            // Spatial queries
+            glue_scene_overlap_sphere,
+            glue_scene_raycast,
+
+            // Direct transform access
+            glue_transform_lease,
+            glue_transform_get_dirty_offset,
+
+            // Jobs
+            glue_jobs_parallel_for,
         };
 
         using BootstrapFn = void(*)(NativeFunctionTable*);
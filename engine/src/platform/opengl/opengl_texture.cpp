@@ -222,8 +222,8 @@ namespace Honey {
 
                     handle->texture = as_tex;
                     handle->done.store(true, std::memory_order_release);
-                });
-            });
+                }, MainPriority::low);
+            }, TaskLane::background);
         }
 
     OpenGLTexture2D::~OpenGLTexture2D()
@@ -331,6 +331,11 @@ namespace Honey {
         p.materials_ssbo_offset = materials_ssbo_offset;
     }
 
+    void VulkanRendererAPI::write_material(uint32_t index, const GPUMaterial& material) {
+        require_frame_begun();
+        globals().write_material(index, material);
+    }
+
     void VulkanRendererAPI::submit_shadow_matrices(const ShadowMatricesSSBO& data) {
         require_frame_begun();
         globals().set_shadow_matrices(data);
@@ -72,6 +72,8 @@ namespace Honey {
         static void submit_lights(const LightsUBO& lights);
         static void submit_tiled_lighting(const TiledLightingData& data);
         static void submit_materials(const std::vector<GPUMaterial>& materials, uint32_t materials_ssbo_offset);
+        // Patches one persistent material slot in the host mirror; uploaded at the next frame top.
+        static void write_material(uint32_t index, const GPUMaterial& material);
         static void submit_shadow_matrices(const ShadowMatricesSSBO& data);
         static void submit_directional_shadows(const DirectionalShadowSSBO& data);
 
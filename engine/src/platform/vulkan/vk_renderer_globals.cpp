@@ -412,6 +412,16 @@ namespace Honey {
         }
     }
 
+    void VulkanRendererGlobals::write_material(uint32_t index, const GPUMaterial& material) {
+        HN_CORE_ASSERT(!m_materials_cpu.empty(), "VulkanRendererGlobals::write_material called before init()");
+        HN_CORE_ASSERT(index < k_max_material_count,
+            "VulkanRendererGlobals::write_material: index {0} exceeds the {1}-element capacity",
+            index, k_max_material_count);
+
+        std::memcpy(m_materials_cpu.data() + (size_t)index * sizeof(GPUMaterial), &material, sizeof(GPUMaterial));
+        m_materials_hwm = std::max(m_materials_hwm, index + 1);
+    }
+
     void VulkanRendererGlobals::set_shadow_matrices(const ShadowMatricesSSBO& data) {
         // Heap-mode deferred lighting reads ShadowMatrices via the set-0 globals buffer
         // (k_global_bindings[ShadowMatrices]). flush_pending() intentionally skips this region,
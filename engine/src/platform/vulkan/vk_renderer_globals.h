@@ -71,6 +71,10 @@ namespace Honey {
         // Folds the pending producer state into the host mirror.
         void flush_pending(uint32_t frame);
 
+        // Writes a single material into the host mirror. Host-only like flush_pending(), so it is
+        // safe from inside a render pass; slots below the high-water mark land this frame.
+        void write_material(uint32_t index, const GPUMaterial& material);
+
         void set_shadow_matrices(const ShadowMatricesSSBO& data);
         void set_directional_shadows(const DirectionalShadowSSBO& data);
 
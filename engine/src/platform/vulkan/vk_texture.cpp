@@ -240,7 +240,7 @@ namespace Honey {
                     handle->done.store(true, std::memory_order_release);
                 });
             });
-        });
+        }, TaskLane::background);
     }
 
     bool VulkanTexture2D::operator==(const Texture& other) const {
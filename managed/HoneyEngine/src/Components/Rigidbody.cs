@@ -1,5 +1,13 @@
 namespace HoneyEngine;
 
+// 3D physics steps on a worker thread while scripts run (PhysicsSettings.async_step_3d), so
+// scripts never touch a body mid-step:
+//   - ApplyForce, ApplyImpulse, setting Velocity and SetPosition are queued and applied when the
+//     in-flight step finishes, before the next one starts. They act one step later than they
+//     would with synchronous stepping; calls keep their order.
+//   - Velocity reads return the value after the last finished step. A velocity set this frame
+//     reads back once the step it is queued for has run.
+//   - Collision callbacks arrive on the main thread, after the step that produced them.
 public readonly struct Rigidbody {
     private readonly ulong _entityId;
 
@@ -3,6 +3,7 @@ namespace HoneyEngine;
 // A lightweight handle into the C++ TransformComponent.
 // Every get/set goes through a native call — there is no cached copy,
 // so the values are always in sync with the engine.
+// For bulk updates over many entities, use TransformSpan instead.
 public readonly struct Transform {
     private readonly ulong _entityId;
 
@@ -0,0 +1,59 @@
+using System.Runtime.InteropServices;
+
+namespace HoneyEngine;
+
+// The leading fields of the C++ TransformComponent, in the same order.
+[StructLayout(LayoutKind.Sequential)]
+public struct TransformData {
+    public Vector3 Translation;
+    public Vector3 Rotation;
+    public Vector3 Scale;
+}
+
+// Direct views of many entities' transforms at once, for scripts that move lots of entities
+// (boids, projectiles). Leasing resolves every entity once; after that reads and writes go
+// straight to component memory with no native call.
+//
+// Only valid for the current update: the engine picks up writes and may move component storage
+// once scripts have run. Entity.Destroy() is deferred until then, so a leased entity destroyed
+// mid-update can still be read and written, but the writes are lost.
+//
+//     Span<nint> storage = stackalloc nint[entities.Length];
+//     var transforms = TransformSpan.Lease(entities, storage);
+//     for (int i = 0; i < transforms.Length; i++)
+//         transforms.Write(i).Translation += velocities[i] * dt;
+//
+// Jobs.ParallelFor has an overload that leases a TransformSpan and splits it across workers.
+public readonly ref struct TransformSpan {
+    private readonly ReadOnlySpan<nint> _transforms;
+
+    // Number of entities that resolved; the rest have no transform (IsValid is false).
+    public readonly int ResolvedCount;
+
+    internal TransformSpan(ReadOnlySpan<nint> transforms, int resolvedCount) {
+        _transforms = transforms;
+        ResolvedCount = resolvedCount;
+    }
+
+    // `storage` must hold at least one slot per entity; the span borrows it.
+    public static TransformSpan Lease(ReadOnlySpan<Entity> entities, Span<nint> storage) {
+        storage = storage[..entities.Length];
+        uint resolved = NativeBindings.Transform_Lease(MemoryMarshal.Cast<Entity, ulong>(entities), storage);
+        return new TransformSpan(storage, (int)resolved);
+    }
+
+    public int Length => _transforms.Length;
+
+    public bool IsValid(int index) => _transforms[index] != 0;
+
+    // Read-only access; does not mark the transform as changed. Index must be valid.
+    public ref readonly TransformData this[int index] => ref NativeBindings.Transform_Ref(_transforms[index]);
+
+    // Writable access. Marks the transform as changed, so world matrices and colliders are
+    // rebuilt this frame. Index must be valid.
+    public ref TransformData Write(int index) {
+        nint transform = _transforms[index];
+        NativeBindings.Transform_MarkDirty(transform);
+        return ref NativeBindings.Transform_Ref(transform);
+    }
+}
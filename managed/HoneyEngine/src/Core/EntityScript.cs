@@ -3,6 +3,8 @@ namespace HoneyEngine;
 public abstract class EntityScript {
     // Set by ScriptRegistry before OnCreate is called.
     internal ulong EntityID { get; set; }
+    // Set once OnDestroy has run; the instance may still be reachable until its handle is freed.
+    internal bool Destroyed { get; set; }
 
     public Entity Entity => new Entity(EntityID);
 
@@ -0,0 +1,88 @@
+using System.Buffers;
+using System.Runtime.ExceptionServices;
+
+namespace HoneyEngine;
+
+// Runs script work across the engine's task-system workers.
+//
+// Rules for code running inside a job:
+//   - The scene is read-only. Reads (Transform getters, Scene queries, Rigidbody.Velocity) are
+//     fine; anything that changes the scene (Transform setters, Rigidbody forces, Destroy,
+//     InstantiatePrefab, TransformSpan.Lease) throws InvalidOperationException.
+//   - Component writes need an explicit write set: the TransformJob overload leases the given
+//     entities' transforms up front, and each index may write only its own entry.
+//   - Script state shared between batches must be partitioned by index the same way.
+//
+// ParallelFor blocks until every index has run. The first exception thrown by the body is
+// rethrown on the calling thread; batches that have not started by then are skipped.
+public delegate void TransformJob(TransformSpan transforms, int index);
+
+public static class Jobs {
+    private static int s_running;
+
+    public static bool IsRunning => Volatile.Read(ref s_running) != 0;
+
+    // Calls body(i) for every i in [0, count). Indices are handed out in runs of at least batchSize;
+    // pick it so that one batch takes at least a few microseconds.
+    public static void ParallelFor(int count, int batchSize, Action<int> body) {
+        ArgumentNullException.ThrowIfNull(body);
+        ArgumentOutOfRangeException.ThrowIfNegative(count);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(batchSize);
+        if (count == 0)
+            return;
+
+        var batch = new JobBatch(body);
+        Interlocked.Increment(ref s_running);
+        try {
+            NativeBindings.Jobs_ParallelFor(count, batchSize, batch);
+        } finally {
+            Interlocked.Decrement(ref s_running);
+        }
+        batch.Error?.Throw();
+    }
+
+    // Leases the transforms of `entities` on the calling thread, then calls body(transforms, i)
+    // for every entity index in parallel. transforms.Write(i) is the only write body may make.
+    public static void ParallelFor(ReadOnlySpan<Entity> entities, int batchSize, TransformJob body) {
+        ArgumentNullException.ThrowIfNull(body);
+        if (entities.IsEmpty)
+            return;
+
+        nint[] leased = ArrayPool<nint>.Shared.Rent(entities.Length);
+        try {
+            int count = entities.Length;
+            int resolved = TransformSpan.Lease(entities, leased).ResolvedCount;
+            ParallelFor(count, batchSize, i => body(new TransformSpan(leased.AsSpan(0, count), resolved), i));
+        } finally {
+            ArrayPool<nint>.Shared.Return(leased);
+        }
+    }
+
+    internal static void ThrowIfRunning(string operation) {
+        if (IsRunning)
+            throw new InvalidOperationException($"{operation} changes the scene and cannot be called from Jobs.ParallelFor");
+    }
+}
+
+internal sealed class JobBatch {
+    private readonly Action<int> _body;
+    private ExceptionDispatchInfo? _error;
+
+    public JobBatch(Action<int> body) {
+        _body = body;
+    }
+
+    public ExceptionDispatchInfo? Error => Volatile.Read(ref _error);
+
+    // Exceptions must not cross back into native code, so the first one is kept for the caller.
+    public void Execute(int begin, int end) {
+        if (Error != null)
+            return;
+        try {
+            for (int i = begin; i < end; i++)
+                _body(i);
+        } catch (Exception ex) {
+            Interlocked.CompareExchange(ref _error, ExceptionDispatchInfo.Capture(ex), null);
+        }
+    }
+}
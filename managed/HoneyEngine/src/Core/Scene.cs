@@ -13,4 +13,32 @@ public static class Scene {
         ulong id = NativeBindings.Scene_FindEntityByName(name);
         return new Entity(id);
     }
-}
\ No newline at end of file
+
+    // Entities whose bounds overlap the sphere. Bounds are mesh bounds, or the entity's
+    // position for entities without a mesh, as of the last transform update.
+    public static List<Entity> OverlapSphere(Vector3 center, float radius) {
+        var results = new List<Entity>();
+        OverlapSphere(center, radius, results);
+        return results;
+    }
+
+    // Non-allocating variant: clears and refills `results`.
+    public static void OverlapSphere(Vector3 center, float radius, List<Entity> results) {
+        results.Clear();
+        Span<ulong> ids = stackalloc ulong[64];
+        uint hits = NativeBindings.Scene_OverlapSphere(center, radius, ids);
+        if (hits > ids.Length) {
+            ids = new ulong[hits];
+            hits = NativeBindings.Scene_OverlapSphere(center, radius, ids);
+        }
+        int count = (int)Math.Min(hits, (uint)ids.Length);
+        for (int i = 0; i < count; i++)
+            results.Add(new Entity(ids[i]));
+    }
+
+    // Nearest entity whose bounds the ray hits. Returns an invalid Entity (ID == 0) on a miss.
+    public static Entity Raycast(Vector3 origin, Vector3 direction, float maxDistance, out float distance) {
+        ulong id = NativeBindings.Scene_Raycast(origin, direction, maxDistance, out distance);
+        return new Entity(id);
+    }
+}
@@ -8,6 +8,8 @@ public static unsafe class ScriptRegistry {
 
     // Maps class name (e.g. "PlayerController") → its Type, for fast instance creation.
     private static readonly Dictionary<string, Type> s_types = new();
+    // Script type → whether it overrides a collision callback. Filled on first instance.
+    private static readonly Dictionary<Type, bool> s_collisionListeners = new();
 
     // Weak reference so the ALC can be garbage-collected after Unload() is called.
     // We don't want to keep the old assembly alive just because the registry saw it.
@@ -38,6 +40,7 @@ public static unsafe class ScriptRegistry {
         }
 
         s_types.Clear();
+        s_collisionListeners.Clear();
         foreach (var type in asm.GetTypes()) {
             if (!type.IsAbstract && type.IsSubclassOf(typeof(EntityScript)))
                 s_types[type.Name] = type;
@@ -52,6 +55,7 @@ public static unsafe class ScriptRegistry {
     [UnmanagedCallersOnly]
     public static void UnloadScriptAssembly() {
         s_types.Clear();
+        s_collisionListeners.Clear();
         if (s_scriptAlc?.TryGetTarget(out var alc) == true) {
             alc.Unload();
             s_scriptAlc = null;
@@ -106,22 +110,53 @@ public static unsafe class ScriptRegistry {
         script.OnUpdate(dt);
     }
 
+    // One transition for the whole frame: C++ passes the scripts' GCHandles, valid for the
+    // duration of the call. A script destroyed by an earlier OnUpdate in the same batch keeps
+    // its handle until the batch returns, so it is skipped rather than freed.
+    [UnmanagedCallersOnly]
+    public static void CallOnUpdateBatch(nint* handles, int count, float dt) {
+        for (int i = 0; i < count; i++) {
+            var script = Unwrap(handles[i]);
+            if (!script.Destroyed)
+                script.OnUpdate(dt);
+        }
+    }
+
     [UnmanagedCallersOnly]
     public static void CallOnDestroy(nint handle, ulong entityId) {
         var script = Unwrap(handle);
+        script.Destroyed = true;
         script.OnDestroy();
     }
 
+    // Whether the script overrides OnCollisionBegin or OnCollisionEnd. C++ only queues
+    // collision events for scripts that do.
     [UnmanagedCallersOnly]
-    public static void CallCollisionBegin(nint handle, ulong entityId, ulong otherId) {
-        var script = Unwrap(handle);
-        script.OnCollisionBegin(new Entity(otherId));
+    public static byte ListensForCollisions(nint handle) {
+        var type = Unwrap(handle).GetType();
+        if (!s_collisionListeners.TryGetValue(type, out bool listens)) {
+            listens = Overrides(type, nameof(EntityScript.OnCollisionBegin))
+                   || Overrides(type, nameof(EntityScript.OnCollisionEnd));
+            s_collisionListeners[type] = listens;
+        }
+        return listens ? (byte)1 : (byte)0;
     }
 
+    // Every collision callback of a frame in one transition: parallel arrays of receiver
+    // GCHandles, the other entity's id and begin (1) / end (0). As in CallOnUpdateBatch, a
+    // receiver destroyed by an earlier callback in the batch is skipped.
     [UnmanagedCallersOnly]
-    public static void CallCollisionEnd(nint handle, ulong entityId, ulong otherId) {
-        var script = Unwrap(handle);
-        script.OnCollisionEnd(new Entity(otherId));
+    public static void CallCollisionBatch(nint* handles, ulong* otherIds, byte* begins, int count) {
+        for (int i = 0; i < count; i++) {
+            var script = Unwrap(handles[i]);
+            if (script.Destroyed)
+                continue;
+
+            if (begins[i] != 0)
+                script.OnCollisionBegin(new Entity(otherIds[i]));
+            else
+                script.OnCollisionEnd(new Entity(otherIds[i]));
+        }
     }
 
     [UnmanagedCallersOnly]
@@ -130,6 +165,9 @@ public static unsafe class ScriptRegistry {
         return s_types.ContainsKey(className) ? (byte)1 : (byte)0;
     }
 
+    private static bool Overrides(Type type, string method) =>
+        type.GetMethod(method, BindingFlags.Public | BindingFlags.Instance)!.DeclaringType != typeof(EntityScript);
+
     private static EntityScript Unwrap(nint handle) =>
         (EntityScript)GCHandle.FromIntPtr(handle).Target!;
 }
\ No newline at end of file
@@ -0,0 +1,116 @@
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+
+namespace HoneyEngine;
+
+// Script-side counterparts of the engine's native benchmarks (engine/src/Honey/debug/benchmarks.h),
+// for code paths that only exist with the .NET host running. `benchmarks --scripts` runs them
+// through RunAll; results go to the log.
+public static class Benchmarks {
+
+    [UnmanagedCallersOnly]
+    public static void RunAll() {
+        CrowdSteering();
+    }
+
+    // Crowd steering (seek a target, separate from neighbours, clamp speed, integrate) over
+    // `agentCount` agents, run serially and through Jobs.ParallelFor. Positions are double
+    // buffered, so both runs must produce bit-identical results.
+    public static void CrowdSteering(int agentCount = 50000, int iterations = 10, int batchSize = 256) {
+        var serial   = new Crowd(agentCount);
+        var parallel = new Crowd(agentCount);
+        const float dt = 1.0f / 60.0f;
+
+        // Warm up both paths so JIT and worker start-up stay out of the timings.
+        serial.StepSerial(dt);
+        parallel.StepParallel(dt, batchSize);
+        serial.Reset();
+        parallel.Reset();
+
+        var timer = Stopwatch.StartNew();
+        for (int it = 0; it < iterations; it++)
+            serial.StepSerial(dt);
+        double serialMs = timer.Elapsed.TotalMilliseconds / iterations;
+
+        timer.Restart();
+        for (int it = 0; it < iterations; it++)
+            parallel.StepParallel(dt, batchSize);
+        double parallelMs = timer.Elapsed.TotalMilliseconds / iterations;
+
+        bool identical = true;
+        for (int i = 0; i < agentCount; i++)
+            identical &= serial.Positions[i] == parallel.Positions[i];
+
+        Log.Info($"[Benchmark] Crowd steering ({agentCount} agents, {iterations} iterations, batch {batchSize})");
+        Log.Info($"  serial {serialMs:F3} ms/frame, Jobs.ParallelFor {parallelMs:F3} ms/frame, " +
+                 $"speedup {serialMs / parallelMs:F2}x, results {(identical ? "match" : "DIFFER")}");
+    }
+
+    private sealed class Crowd {
+        private const int   k_neighbours      = 8;
+        private const float k_max_speed       = 4.0f;
+        private const float k_separation_dist = 1.5f;
+
+        private readonly int _count;
+        private Vector3[] _positions;
+        private Vector3[] _next;
+        private readonly Vector3[] _velocities;
+        private readonly Vector3[] _targets;
+
+        public Vector3[] Positions => _positions;
+
+        public Crowd(int count) {
+            _count = count;
+            _positions  = new Vector3[count];
+            _next       = new Vector3[count];
+            _velocities = new Vector3[count];
+            _targets    = new Vector3[count];
+            Reset();
+        }
+
+        public void Reset() {
+            // Deterministic layout: a grid walking towards the mirrored grid cell.
+            int side = (int)MathF.Ceiling(MathF.Sqrt(_count));
+            for (int i = 0; i < _count; i++) {
+                float x = i % side, z = i / side;
+                _positions[i]  = new Vector3(x, 0.0f, z);
+                _velocities[i] = Vector3.Zero;
+                _targets[i]    = new Vector3(side - x, 0.0f, side - z);
+            }
+        }
+
+        public void StepSerial(float dt) {
+            for (int i = 0; i < _count; i++)
+                Steer(i, dt);
+            Swap();
+        }
+
+        public void StepParallel(float dt, int batchSize) {
+            Jobs.ParallelFor(_count, batchSize, i => Steer(i, dt));
+            Swap();
+        }
+
+        private void Swap() => (_positions, _next) = (_next, _positions);
+
+        // Reads only the current buffer and writes only index i, so indices can run in any order.
+        private void Steer(int i, float dt) {
+            Vector3 position = _positions[i];
+            Vector3 steering = (_targets[i] - position).Normalized() * k_max_speed - _velocities[i];
+
+            for (int n = 1; n <= k_neighbours; n++) {
+                Vector3 away = position - _positions[(i + n * 97) % _count];
+                float distance = away.Length();
+                if (distance > 0.0f && distance < k_separation_dist)
+                    steering += away * ((k_separation_dist - distance) / distance);
+            }
+
+            Vector3 velocity = _velocities[i] + steering * dt;
+            float speed = velocity.Length();
+            if (speed > k_max_speed)
+                velocity *= k_max_speed / speed;
+
+            _velocities[i] = velocity;
+            _next[i] = position + velocity * dt;
+        }
+    }
+}
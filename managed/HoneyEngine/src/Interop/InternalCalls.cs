@@ -36,13 +36,24 @@ public unsafe struct NativeFunctionTable {
     public delegate* unmanaged<byte*, ulong>                 Scene_FindEntityByName;
     public delegate* unmanaged<float>                        Input_GetMouseDeltaX;
     public delegate* unmanaged<float>                        Input_GetMouseDeltaY;
+
+    public delegate* unmanaged<float*, float, ulong*, uint, uint>    Scene_OverlapSphere;
+    public delegate* unmanaged<float*, float*, float, float*, ulong> Scene_Raycast;
+
+    public delegate* unmanaged<ulong*, uint, nint*, uint>    Transform_Lease;
+    public delegate* unmanaged<uint>                         Transform_GetDirtyOffset;
+
+    public delegate* unmanaged<uint, uint, delegate* unmanaged<nint, uint, uint, void>, nint, void> Jobs_ParallelFor;
 }
 
 public static unsafe class InternalCalls {
     internal static NativeFunctionTable s_table;
+    // Byte offset of TransformComponent::dirty, so leased transforms can be flagged without a call.
+    internal static uint s_transformDirtyOffset;
 
     [UnmanagedCallersOnly]
     public static void Bootstrap(NativeFunctionTable* table) {
         s_table = *table;
+        s_transformDirtyOffset = s_table.Transform_GetDirtyOffset();
     }
 }
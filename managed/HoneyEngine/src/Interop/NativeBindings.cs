@@ -16,6 +16,7 @@ internal static unsafe class NativeBindings {
     }
 
     internal static void Entity_SetTranslation(ulong id, Vector3 v) {
+        Jobs.ThrowIfRunning(nameof(Entity_SetTranslation));
         float* xyz = stackalloc float[3];
         xyz[0] = v.X; xyz[1] = v.Y; xyz[2] = v.Z;
         InternalCalls.s_table.Entity_SetTranslation(id, xyz);
@@ -28,6 +29,7 @@ internal static unsafe class NativeBindings {
     }
 
     internal static void Entity_SetRotation(ulong id, Vector3 v) {
+        Jobs.ThrowIfRunning(nameof(Entity_SetRotation));
         float* xyz = stackalloc float[3];
         xyz[0] = v.X; xyz[1] = v.Y; xyz[2] = v.Z;
         InternalCalls.s_table.Entity_SetRotation(id, xyz);
@@ -40,13 +42,49 @@ internal static unsafe class NativeBindings {
     }
 
     internal static void Entity_SetScale(ulong id, Vector3 v) {
+        Jobs.ThrowIfRunning(nameof(Entity_SetScale));
         float* xyz = stackalloc float[3];
         xyz[0] = v.X; xyz[1] = v.Y; xyz[2] = v.Z;
         InternalCalls.s_table.Entity_SetScale(id, xyz);
     }
 
+    // Pointers straight into TransformComponent storage; see TransformSpan for their lifetime.
+    internal static uint Transform_Lease(ReadOnlySpan<ulong> ids, Span<nint> transforms) {
+        Jobs.ThrowIfRunning(nameof(Transform_Lease));
+        fixed (ulong* i = ids)
+        fixed (nint* t = transforms) {
+            return InternalCalls.s_table.Transform_Lease(i, (uint)ids.Length, t);
+        }
+    }
+
+    internal static ref TransformData Transform_Ref(nint transform) {
+        return ref *(TransformData*)transform;
+    }
+
+    internal static void Transform_MarkDirty(nint transform) {
+        *((byte*)transform + InternalCalls.s_transformDirtyOffset) = 1;
+    }
+
+    // --- Jobs ---
+
+    internal static void Jobs_ParallelFor(int count, int batchSize, JobBatch batch) {
+        GCHandle handle = GCHandle.Alloc(batch);
+        try {
+            InternalCalls.s_table.Jobs_ParallelFor((uint)count, (uint)batchSize, &Jobs_ExecuteRange, GCHandle.ToIntPtr(handle));
+        } finally {
+            handle.Free();
+        }
+    }
+
+    // Runs on task-system worker threads as well as the caller's.
+    [UnmanagedCallersOnly]
+    private static void Jobs_ExecuteRange(nint batch, uint begin, uint end) {
+        ((JobBatch)GCHandle.FromIntPtr(batch).Target!).Execute((int)begin, (int)end);
+    }
+
     // --- Scene ---
     internal static ulong Scene_InstantiatePrefab(string path) {
+        Jobs.ThrowIfRunning(nameof(Scene_InstantiatePrefab));
         // Encode the path as a null-terminated UTF-8 byte buffer.
         int maxBytes = Encoding.UTF8.GetMaxByteCount(path.Length) + 1;
         if (maxBytes <= 512) {
@@ -71,14 +109,17 @@ internal static unsafe class NativeBindings {
     // --- Physics ---
 
     internal static void Rigidbody2D_ApplyLinearImpulse(ulong id, float x, float y, float wake) {
+        Jobs.ThrowIfRunning(nameof(Rigidbody2D_ApplyLinearImpulse));
         InternalCalls.s_table.Rigidbody2D_ApplyLinearImpulse(id, x, y, wake);
     }
 
     internal static void Rigidbody_ApplyForce(ulong id, float x, float y, float z) {
+        Jobs.ThrowIfRunning(nameof(Rigidbody_ApplyForce));
         InternalCalls.s_table.Rigidbody_ApplyForce(id, x, y, z);
     }
 
     internal static void Rigidbody_ApplyImpulse(ulong id, float x, float y, float z) {
+        Jobs.ThrowIfRunning(nameof(Rigidbody_ApplyImpulse));
         InternalCalls.s_table.Rigidbody_ApplyImpulse(id, x, y, z);
     }
 
@@ -89,10 +130,12 @@ internal static unsafe class NativeBindings {
     }
 
     internal static void Rigidbody_SetVelocity(ulong id, Vector3 v) {
+        Jobs.ThrowIfRunning(nameof(Rigidbody_SetVelocity));
         InternalCalls.s_table.Rigidbody_SetVelocity(id, v.X, v.Y, v.Z);
     }
 
     internal static void Rigidbody_SetPosition(ulong id, Vector3 v) {
+        Jobs.ThrowIfRunning(nameof(Rigidbody_SetPosition));
         InternalCalls.s_table.Rigidbody_SetPosition(id, v.X, v.Y, v.Z);
     }
 
@@ -130,6 +173,7 @@ internal static unsafe class NativeBindings {
     // --- Entity lifecycle ---
 
     internal static void Entity_Destroy(ulong id) {
+        Jobs.ThrowIfRunning(nameof(Entity_Destroy));
         InternalCalls.s_table.Entity_Destroy(id);
     }
 
@@ -155,6 +199,25 @@ internal static unsafe class NativeBindings {
         }
     }
 
+    internal static uint Scene_OverlapSphere(Vector3 center, float radius, Span<ulong> ids) {
+        float* c = stackalloc float[3];
+        c[0] = center.X; c[1] = center.Y; c[2] = center.Z;
+        fixed (ulong* p = ids) {
+            return InternalCalls.s_table.Scene_OverlapSphere(c, radius, p, (uint)ids.Length);
+        }
+    }
+
+    internal static ulong Scene_Raycast(Vector3 origin, Vector3 direction, float maxDistance, out float distance) {
+        float* o = stackalloc float[3];
+        float* d = stackalloc float[3];
+        o[0] = origin.X;    o[1] = origin.Y;    o[2] = origin.Z;
+        d[0] = direction.X; d[1] = direction.Y; d[2] = direction.Z;
+        float dist = 0.0f;
+        ulong id = InternalCalls.s_table.Scene_Raycast(o, d, maxDistance, &dist);
+        distance = dist;
+        return id;
+    }
+
     // --- Input ---
 
     internal static bool Input_IsKeyDown(int keyCode) {